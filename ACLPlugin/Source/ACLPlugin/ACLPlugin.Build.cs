@@ -25,8 +25,15 @@ namespace UnrealBuildTool.Rules
 			PublicDependencyModuleNames.Add("CoreUObject");
 			PublicDependencyModuleNames.Add("Engine");
 
+			if (Target.Version.MajorVersion >= 5 || Target.Version.MinorVersion >= 26)
+			{
+				// UDeveloperSettings moved out of the Engine module with UE 4.26
+				PublicDependencyModuleNames.Add("DeveloperSettings");
+			}
+
 			if (Target.bBuildEditor)
 			{
+				PrivateDependencyModuleNames.Add("DerivedDataCache");
 				PrivateDependencyModuleNames.Add("DesktopPlatform");
 				PrivateDependencyModuleNames.Add("UnrealEd");
 			}
@@ -0,0 +1,26 @@
+#pragma once
+
+// Copyright 2026 Nicholas Frechette. All Rights Reserved.
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "UObject/ObjectMacros.h"
+#include "ACLPluginSettings.generated.h"
+
+/** Project wide settings for the ACL plugin. */
+UCLASS(MinimalAPI, config = Engine, defaultconfig, meta = (DisplayName = "Animation Compression Library"))
+class UACLPluginSettings : public UDeveloperSettings
+{
+	GENERATED_UCLASS_BODY()
+
+	/**
+	 * The bones that dedicated servers require (e.g. hit boxes, the bones weapon sockets are attached to).
+	 * Their parents and the root bone are included automatically. When present, every sequence stores the subset of its tracks
+	 * for these bones and dedicated servers only decompress them (see ACL.ServerBoneSubset). Sequences must be recompressed when this changes.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Dedicated Server")
+	TArray<FName> ServerBoneNames;
+
+	// UDeveloperSettings implementation
+	virtual FName GetCategoryName() const override { return TEXT("Plugins"); }
+};
@@ -26,14 +26,57 @@ struct FACLCompressedAnimData final : public ICompressedAnimData
 	/** Holds the compressed_tracks instance */
 	TArrayView<uint8> CompressedByteStream;
 
+	/** Whether or not the compressed data passed validation when it was bound. Invalid data is never decompressed. */
+	bool bIsDataValid = false;
+
+	/** Whether or not the sequence was compressed with a dedicated server track subset (see UACLPluginSettings::ServerBoneNames). */
+	bool bHasServerTrackSubset = false;
+
+	/** The sorted tracks required by dedicated servers, lives after the compressed_tracks instance in our compressed byte stream. */
+	TArrayView<const uint16> ServerTrackIndices;
+
 	const acl::compressed_tracks* GetCompressedTracks() const { return acl::make_compressed_tracks(CompressedByteStream.GetData()); }
 
 	// ICompressedAnimData implementation
-	virtual void Bind(const TArrayView<uint8> BulkData) override { CompressedByteStream = BulkData; }
+	virtual void Bind(const TArrayView<uint8> BulkData) override;
 	virtual int64 GetApproxCompressedSize() const override { return CompressedByteStream.Num(); }
 	virtual bool IsValid() const override;
 };
 
+struct FACLPoseAccumulator;
+class UAnimBoneCompressionCodec_ACLBase;
+
+/** A weighted sample to blend with UAnimBoneCompressionCodec_ACLBase::DecompressWeightedPoses(..). */
+struct FACLWeightedPoseSample
+{
+	/** The codec used by the sampled sequence. */
+	const UAnimBoneCompressionCodec_ACLBase* Codec = nullptr;
+
+	/** The decompression context of the sampled sequence, bound to its compressed data and evaluation time. */
+	FAnimSequenceDecompressionContext* DecompContext = nullptr;
+
+	/** The track mappings of the sampled sequence, like with UAnimBoneCompressionCodec::DecompressPose(..). */
+	const BoneTrackArray* RotationPairs = nullptr;
+	const BoneTrackArray* TranslationPairs = nullptr;
+	const BoneTrackArray* ScalePairs = nullptr;
+
+	/** The blend weight of the sample. */
+	float Weight = 0.0f;
+};
+
+/*
+ * The output of UAnimBoneCompressionCodec_ACLBase::DecompressBonesAtTimes(..) in SoA form (e.g. for motion matching or pose search).
+ * The value of the bone TrackIndices[BoneIndex] at Times[SampleIndex] lives at [SampleIndex * NumBones + BoneIndex].
+ * Velocities are optional, leave their views empty to skip them.
+ */
+struct FACLPoseSamplesSoA
+{
+	TArrayView<FQuat> Rotations;
+	TArrayView<FVector> Translations;
+	TArrayView<FVector> LinearVelocities;
+	TArrayView<FVector> AngularVelocities;
+};
+
 /** The base codec implementation for ACL support. */
 UCLASS(abstract, MinimalAPI)
 class UAnimBoneCompressionCodec_ACLBase : public UAnimBoneCompressionCodec
@@ -80,4 +123,60 @@ class UAnimBoneCompressionCodec_ACLBase : public UAnimBoneCompressionCodec
 	virtual TUniquePtr<ICompressedAnimData> AllocateAnimData() const override;
 	virtual void ByteSwapIn(ICompressedAnimData& AnimData, TArrayView<uint8> CompressedData, FMemoryReader& MemoryStream) const override;
 	virtual void ByteSwapOut(ICompressedAnimData& AnimData, TArrayView<uint8> CompressedData, FMemoryWriter& MemoryStream) const override;
+
+	// Our decompression implementation
+
+	/**
+	 * Decompresses multiple tracks of the same sequence at once (e.g. for IK, foot placement, or socket queries).
+	 * This is faster than calling DecompressBone for each track since we seek once and read the compressed pose once.
+	 * OutAtoms[i] receives the transform of the track TrackIndices[i].
+	 */
+	virtual void DecompressBones(FAnimSequenceDecompressionContext& DecompContext, const TArrayView<const int32> TrackIndices, TArrayView<FTransform> OutAtoms) const PURE_VIRTUAL(UAnimBoneCompressionCodec_ACLBase::DecompressBones, );
+
+	/**
+	 * Decompresses a single track at multiple sample times with a single decompression context (e.g. for root motion extraction).
+	 * The evaluation time of the decompression context is ignored, OutAtoms[i] receives the transform of the track at Times[i].
+	 */
+	virtual void DecompressBoneAtTimes(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, const TArrayView<const float> Times, TArrayView<FTransform> OutAtoms) const PURE_VIRTUAL(UAnimBoneCompressionCodec_ACLBase::DecompressBoneAtTimes, );
+
+	/**
+	 * Decompresses several tracks of the same sequence at multiple sample times with a single decompression context (e.g. for motion matching or pose search).
+	 * The evaluation time of the decompression context is ignored and sample times should be sorted. Scale is not decompressed.
+	 * Velocities, when requested, are estimated with finite differences between adjacent samples.
+	 */
+	virtual void DecompressBonesAtTimes(FAnimSequenceDecompressionContext& DecompContext, const TArrayView<const int32> TrackIndices, const TArrayView<const float> Times, FACLPoseSamplesSoA& OutSamples) const PURE_VIRTUAL(UAnimBoneCompressionCodec_ACLBase::DecompressBonesAtTimes, );
+
+	/**
+	 * Returns the transform delta of a track between two sample times, relative to the start transform (e.g. root motion).
+	 * Looping is not handled, ranges that wrap around must be split by the caller.
+	 */
+	ACLPLUGIN_API FTransform ExtractRootMotionDelta(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, float StartTime, float EndTime) const;
+
+	/**
+	 * Decompresses an additive sequence and applies it with the provided weight onto the base pose held in InOutAtoms.
+	 * This is equivalent to decompressing the additive pose and calling FAnimationRuntime::AccumulateAdditivePose(..)
+	 * with a local space additive but only the animated sub-tracks are processed and no intermediate pose is required.
+	 */
+	virtual void ApplyAdditivePose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, float Weight, TArrayView<FTransform>& InOutAtoms) const PURE_VIRTUAL(UAnimBoneCompressionCodec_ACLBase::ApplyAdditivePose, );
+
+	/**
+	 * Decompresses a pose like DecompressPose(..) and converts it to component space right away while it is still in the cache
+	 * (e.g. for physics blending, IK, or server hit boxes). ParentAtomIndices[i] is the index of the parent of OutAtoms[i] or INDEX_NONE
+	 * for roots, parents must precede their children (as with compact pose bone indices). OutAtoms must hold the reference pose
+	 * of bones without tracks, like with DecompressPose(..).
+	 */
+	ACLPLUGIN_API void DecompressPoseComponentSpace(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, const TArrayView<const int32> ParentAtomIndices, TArrayView<FTransform>& OutAtoms, TArrayView<FTransform> OutComponentSpaceAtoms) const;
+
+	/**
+	 * Decompresses and blends several weighted samples (e.g. of a blend space or sync group) in a single call.
+	 * Each sample is accumulated directly as it is decompressed, no intermediate pose is required.
+	 * Every sample must map the same output transforms and the weights should sum to one.
+	 * OutAtoms must hold the reference pose like with DecompressPose(..), bones a sample doesn't write retain it for that sample's weight.
+	 * Samples may use different ACL codecs.
+	 */
+	ACLPLUGIN_API static void DecompressWeightedPoses(const TArrayView<const FACLWeightedPoseSample> Samples, TArrayView<FTransform> OutAtoms);
+
+protected:
+	/** Decompresses a pose and accumulates it with the provided weight. */
+	virtual void AccumulatePose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, float Weight, FACLPoseAccumulator& Accumulator) const PURE_VIRTUAL(UAnimBoneCompressionCodec_ACLBase::AccumulatePose, );
 };
@@ -28,6 +28,9 @@ struct FACLDatabaseCompressedAnimData final : public ICompressedAnimData
 	/** The sequence name hash that owns this data. */
 	uint32 SequenceNameHash = 0;
 
+	/** Whether or not the compressed data passed validation when it was bound. Invalid data is never decompressed. */
+	bool bIsDataValid = false;
+
 #if WITH_EDITORONLY_DATA
 	/** Holds the compressed_tracks instance for the anim sequence */
 	TArray<uint8> CompressedClip;
@@ -98,4 +101,18 @@ class UAnimBoneCompressionCodec_ACLDatabase : public UAnimBoneCompressionCodec_A
 	virtual void ByteSwapOut(ICompressedAnimData& AnimData, TArrayView<uint8> CompressedData, FMemoryWriter& MemoryStream) const override;
 	virtual void DecompressPose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, TArrayView<FTransform>& OutAtoms) const override;
 	virtual void DecompressBone(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, FTransform& OutAtom) const override;
+
+	// UAnimBoneCompressionCodec_ACLBase implementation
+	virtual void DecompressBones(FAnimSequenceDecompressionContext& DecompContext, const TArrayView<const int32> TrackIndices, TArrayView<FTransform> OutAtoms) const override;
+	virtual void DecompressBoneAtTimes(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, const TArrayView<const float> Times, TArrayView<FTransform> OutAtoms) const override;
+	virtual void DecompressBonesAtTimes(FAnimSequenceDecompressionContext& DecompContext, const TArrayView<const int32> TrackIndices, const TArrayView<const float> Times, FACLPoseSamplesSoA& OutSamples) const override;
+	virtual void ApplyAdditivePose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, float Weight, TArrayView<FTransform>& InOutAtoms) const override;
+
+protected:
+	// UAnimBoneCompressionCodec_ACLBase implementation
+	virtual void AccumulatePose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, float Weight, FACLPoseAccumulator& Accumulator) const override;
+
+private:
+	/** Returns an initialized decompression context for the provided sequence or nullptr if it has no compressed data. */
+	acl::decompression_context<UEDefaultDBDecompressionSettings>* GetDecompressionContext(const FACLDatabaseCompressedAnimData& AnimData) const;
 };
@@ -28,4 +28,14 @@ class UAnimBoneCompressionCodec_ACLSafe : public UAnimBoneCompressionCodec_ACLBa
 	// UAnimBoneCompressionCodec implementation
 	virtual void DecompressPose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, TArrayView<FTransform>& OutAtoms) const override;
 	virtual void DecompressBone(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, FTransform& OutAtom) const override;
+
+	// UAnimBoneCompressionCodec_ACLBase implementation
+	virtual void DecompressBones(FAnimSequenceDecompressionContext& DecompContext, const TArrayView<const int32> TrackIndices, TArrayView<FTransform> OutAtoms) const override;
+	virtual void DecompressBoneAtTimes(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, const TArrayView<const float> Times, TArrayView<FTransform> OutAtoms) const override;
+	virtual void DecompressBonesAtTimes(FAnimSequenceDecompressionContext& DecompContext, const TArrayView<const int32> TrackIndices, const TArrayView<const float> Times, FACLPoseSamplesSoA& OutSamples) const override;
+	virtual void ApplyAdditivePose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, float Weight, TArrayView<FTransform>& InOutAtoms) const override;
+
+protected:
+	// UAnimBoneCompressionCodec_ACLBase implementation
+	virtual void AccumulatePose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, float Weight, FACLPoseAccumulator& Accumulator) const override;
 };
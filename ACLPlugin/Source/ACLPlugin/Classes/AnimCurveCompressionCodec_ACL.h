@@ -42,4 +42,16 @@ class UAnimCurveCompressionCodec_ACL : public UAnimCurveCompressionCodec
 #else
 	virtual float DecompressCurve(const FCompressedAnimSequence& AnimSeq, SmartName::UID_Type CurveUID, float CurrentTime) const override;
 #endif
+
+	// Our decompression implementation
+
+	/**
+	 * Decompresses multiple curves of the same sequence at once with a single decompression context.
+	 * OutValues[i] receives the value of the i-th curve requested or 0.0 if the sequence does not contain it.
+	 */
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
+	ACLPLUGIN_API void DecompressCurves(const FCompressedAnimSequence& AnimSeq, const TArrayView<const FName> CurveNames, float CurrentTime, TArrayView<float> OutValues) const;
+#else
+	ACLPLUGIN_API void DecompressCurves(const FCompressedAnimSequence& AnimSeq, const TArrayView<const SmartName::UID_Type> CurveNames, float CurrentTime, TArrayView<float> OutValues) const;
+#endif
 };
@@ -0,0 +1,807 @@
+// Copyright 2026 Nicholas Frechette. All Rights Reserved.
+
+#include "ACLDecompressionImpl.h"
+#include "ACLDecompressionLOD.h"
+#include "HAL/IConsoleManager.h"
+
+#include <atomic>
+
+CSV_DEFINE_CATEGORY(ACL, true);
+
+// Bumped every time a database changes, cached entries built with an older epoch are stale
+static std::atomic<uint32> GDecompressionCacheEpoch(1);
+
+void InvalidateDecompressionCaches()
+{
+	GDecompressionCacheEpoch.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint32 GetDecompressionCacheEpoch()
+{
+	return GDecompressionCacheEpoch.load(std::memory_order_relaxed);
+}
+
+/** A track to atom mapping along with the required bones it was built with. */
+struct FTrackToAtomsCacheEntry
+{
+	// Compressed tracks the mapping was last built for, along with their hash
+	const acl::compressed_tracks* CompressedClipData = nullptr;
+	uint32 CompressedHash = 0;
+
+	// The required bones the mapping was built with, owned by the caller and identified by their address and size
+	// The engine fills them in scratch memory that is re-used between calls, they are only trusted within a frame
+	const BoneTrackPair* RotationPairs = nullptr;
+	const BoneTrackPair* TranslationPairs = nullptr;
+	const BoneTrackPair* ScalePairs = nullptr;
+	int32 NumRotationPairs = 0;
+	int32 NumTranslationPairs = 0;
+	int32 NumScalePairs = 0;
+	int32 NumAtoms = 0;
+	uint64 FrameCounter = ~0ULL;
+
+	// The last required bone of each array, a cheap guard against different bones of the same size in the same frame
+	BoneTrackPair LastRotationPair = BoneTrackPair(INDEX_NONE, INDEX_NONE);
+	BoneTrackPair LastTranslationPair = BoneTrackPair(INDEX_NONE, INDEX_NONE);
+
+	// The mapping is only valid for a number of tracks and the presence of scale
+	bool bHasScale = false;
+
+	// Unique per thread for every mapping built, see GetTrackToAtomsMap(..)
+	uint32 MappingId = 0;
+
+	TArray<FAtomIndices> TrackToAtomsMap;
+};
+
+/*
+ * A small direct mapped cache of track to atom mappings.
+ * It lives in thread local storage since animations are decompressed in parallel on many threads.
+ */
+struct FTrackToAtomsCache
+{
+	static constexpr uint32 NumEntries = 64;
+
+	FTrackToAtomsCacheEntry Entries[NumEntries];
+
+	// The last mapping identifier handed out, zero is never used
+	uint32 LastMappingId = 0;
+
+	// The mapping an entry held before it was rebuilt, used to tell if it changed
+	TArray<FAtomIndices> PreviousTrackToAtomsMap;
+};
+
+static thread_local FTrackToAtomsCache GTrackToAtomsCache;
+
+static BoneTrackPair GetLastBoneTrackPair(const BoneTrackArray& Pairs)
+{
+	return Pairs.Num() != 0 ? Pairs.Last() : BoneTrackPair(INDEX_NONE, INDEX_NONE);
+}
+
+static bool IsSameBoneTrackPair(const BoneTrackPair& PairA, const BoneTrackPair& PairB)
+{
+	return PairA.AtomIndex == PairB.AtomIndex && PairA.TrackIndex == PairB.TrackIndex;
+}
+
+static void BuildTrackToAtomsMap(FTrackToAtomsCacheEntry& Entry, int32 ACLBoneCount, int32 NumAtoms,
+	const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs)
+{
+	TArray<FAtomIndices>& TrackToAtomsMap = Entry.TrackToAtomsMap;
+
+	// TODO: Allocate this with padding and use SIMD to set everything to 0xFF
+	TrackToAtomsMap.SetNumUninitialized(ACLBoneCount, false);
+	FMemory::Memset(TrackToAtomsMap.GetData(), 0xFF, sizeof(FAtomIndices) * ACLBoneCount);
+
+	// TODO: We should only need 1x uint16 atom index for each track/bone index
+	// and we need 3 bits to tell whether we care about the rot/trans/scale
+	// The rot and scale pairs are often the same array, skip the scale iteration and set both flags while
+	// iterating on the rotation pairs. This will reduce the mapping size by 2 bytes if we use 4 bytes.
+	// All reads will be aligned, can we pack further with 1x uint16 and 1x uint8 and do unaligned loads?
+	// Need to double check what the ASM looks like on x64 and ARM first to make sure it's good
+	// Maybe having two arrays side by side is better with uint16/uint8? Or having 1 bitset array?
+	// Ultimately, when we load these indices, they will most likely be in the L1 since the mapping is
+	// cached and reused every frame. Optimizing for quick loading/unpacking it best.
+
+#if DO_CHECK
+	int32 MinAtomIndex = NumAtoms;
+	int32 MaxAtomIndex = -1;
+	int32 MinTrackIndex = INT_MAX;
+	int32 MaxTrackIndex = -1;
+#endif
+
+	for (const BoneTrackPair& Pair : RotationPairs)
+	{
+		TrackToAtomsMap[Pair.TrackIndex].Rotation = (uint16)Pair.AtomIndex;
+
+#if DO_CHECK
+		MinAtomIndex = FMath::Min(MinAtomIndex, Pair.AtomIndex);
+		MaxAtomIndex = FMath::Max(MaxAtomIndex, Pair.AtomIndex);
+		MinTrackIndex = FMath::Min(MinTrackIndex, Pair.TrackIndex);
+		MaxTrackIndex = FMath::Max(MaxTrackIndex, Pair.TrackIndex);
+#endif
+	}
+
+	for (const BoneTrackPair& Pair : TranslationPairs)
+	{
+		TrackToAtomsMap[Pair.TrackIndex].Translation = (uint16)Pair.AtomIndex;
+
+#if DO_CHECK
+		MinAtomIndex = FMath::Min(MinAtomIndex, Pair.AtomIndex);
+		MaxAtomIndex = FMath::Max(MaxAtomIndex, Pair.AtomIndex);
+		MinTrackIndex = FMath::Min(MinTrackIndex, Pair.TrackIndex);
+		MaxTrackIndex = FMath::Max(MaxTrackIndex, Pair.TrackIndex);
+#endif
+	}
+
+	if (Entry.bHasScale)
+	{
+		for (const BoneTrackPair& Pair : ScalePairs)
+		{
+			TrackToAtomsMap[Pair.TrackIndex].Scale = (uint16)Pair.AtomIndex;
+
+#if DO_CHECK
+			MinAtomIndex = FMath::Min(MinAtomIndex, Pair.AtomIndex);
+			MaxAtomIndex = FMath::Max(MaxAtomIndex, Pair.AtomIndex);
+			MinTrackIndex = FMath::Min(MinTrackIndex, Pair.TrackIndex);
+			MaxTrackIndex = FMath::Max(MaxTrackIndex, Pair.TrackIndex);
+#endif
+		}
+	}
+
+#if DO_CHECK
+	// Only assert once for performance reasons, when we write the pose, we won't perform the checks
+	checkf(MinAtomIndex >= 0 && MinAtomIndex < NumAtoms, TEXT("Invalid atom index: %d"), MinAtomIndex);
+	checkf(MaxAtomIndex >= 0 && MaxAtomIndex < NumAtoms, TEXT("Invalid atom index: %d"), MaxAtomIndex);
+	checkf(MinTrackIndex >= 0, TEXT("Invalid track index: %d"), MinTrackIndex);
+	checkf(MaxTrackIndex < ACLBoneCount, TEXT("Invalid track index: %d"), MaxTrackIndex);
+#endif
+}
+
+const FAtomIndices* GetTrackToAtomsMap(const acl::compressed_tracks& CompressedClipData,
+	const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs,
+	int32 NumAtoms, uint32* OutMappingId)
+{
+	const int32 ACLBoneCount = CompressedClipData.get_num_tracks();
+	const acl::acl_impl::tracks_header& TracksHeader = acl::acl_impl::get_tracks_header(CompressedClipData);
+	const bool bHasScale = TracksHeader.get_has_scale();
+
+	// Different LODs of the same sequence have a different number of required bones, use it to pick our slot
+	uint32 EntryHash = PointerHash(&CompressedClipData);
+	EntryHash = HashCombine(EntryHash, GetTypeHash(RotationPairs.Num()));
+	EntryHash = HashCombine(EntryHash, GetTypeHash(TranslationPairs.Num()));
+
+	FTrackToAtomsCacheEntry& Entry = GTrackToAtomsCache.Entries[EntryHash % FTrackToAtomsCache::NumEntries];
+
+	// The mapping only depends on the required bones, the number of tracks, and whether or not we have scale.
+	// Comparing the required bones would read as much memory as rebuilding the mapping does, we instead
+	// identify them by their address and size which the engine keeps stable for a given pose within a frame.
+	// The compressed data hash guards against its pointer being re-used by a different sequence.
+	const bool bIsCacheHit = Entry.CompressedClipData == &CompressedClipData &&
+		Entry.CompressedHash == CompressedClipData.get_hash() &&
+		Entry.FrameCounter == uint64(GFrameCounter) &&
+		Entry.TrackToAtomsMap.Num() == ACLBoneCount &&
+		Entry.bHasScale == bHasScale &&
+		Entry.NumAtoms == NumAtoms &&
+		Entry.RotationPairs == RotationPairs.GetData() &&
+		Entry.NumRotationPairs == RotationPairs.Num() &&
+		Entry.TranslationPairs == TranslationPairs.GetData() &&
+		Entry.NumTranslationPairs == TranslationPairs.Num() &&
+		(!bHasScale || (Entry.ScalePairs == ScalePairs.GetData() && Entry.NumScalePairs == ScalePairs.Num())) &&
+		IsSameBoneTrackPair(Entry.LastRotationPair, GetLastBoneTrackPair(RotationPairs)) &&
+		IsSameBoneTrackPair(Entry.LastTranslationPair, GetLastBoneTrackPair(TranslationPairs));
+
+	if (bIsCacheHit)
+	{
+		CSV_CUSTOM_STAT(ACL, TrackMappingCacheHits, 1, ECsvCustomStatOp::Accumulate);
+
+		if (OutMappingId != nullptr)
+		{
+			*OutMappingId = Entry.MappingId;
+		}
+
+		return Entry.TrackToAtomsMap.GetData();
+	}
+
+	CSV_CUSTOM_STAT(ACL, TrackMappingCacheMisses, 1, ECsvCustomStatOp::Accumulate);
+
+	// Entries are rebuilt every frame, keep the previous mapping around to retain its identifier if nothing changed
+	const bool bCanRetainMappingId = Entry.MappingId != 0 &&
+		Entry.CompressedClipData == &CompressedClipData &&
+		Entry.CompressedHash == CompressedClipData.get_hash() &&
+		Entry.TrackToAtomsMap.Num() == ACLBoneCount &&
+		Entry.bHasScale == bHasScale;
+
+	TArray<FAtomIndices>& PreviousTrackToAtomsMap = GTrackToAtomsCache.PreviousTrackToAtomsMap;
+	if (bCanRetainMappingId)
+	{
+		Swap(Entry.TrackToAtomsMap, PreviousTrackToAtomsMap);
+	}
+
+	Entry.CompressedClipData = &CompressedClipData;
+	Entry.CompressedHash = CompressedClipData.get_hash();
+	Entry.FrameCounter = uint64(GFrameCounter);
+	Entry.bHasScale = bHasScale;
+	Entry.NumAtoms = NumAtoms;
+	Entry.RotationPairs = RotationPairs.GetData();
+	Entry.NumRotationPairs = RotationPairs.Num();
+	Entry.TranslationPairs = TranslationPairs.GetData();
+	Entry.NumTranslationPairs = TranslationPairs.Num();
+	Entry.ScalePairs = bHasScale ? ScalePairs.GetData() : nullptr;
+	Entry.NumScalePairs = bHasScale ? ScalePairs.Num() : 0;
+	Entry.LastRotationPair = GetLastBoneTrackPair(RotationPairs);
+	Entry.LastTranslationPair = GetLastBoneTrackPair(TranslationPairs);
+
+	BuildTrackToAtomsMap(Entry, ACLBoneCount, NumAtoms, RotationPairs, TranslationPairs, ScalePairs);
+
+	// The keyframe cache is keyed on the mapping identifier, it must only change along with the mapping
+	const bool bIsSameMapping = bCanRetainMappingId &&
+		FMemory::Memcmp(Entry.TrackToAtomsMap.GetData(), PreviousTrackToAtomsMap.GetData(), sizeof(FAtomIndices) * ACLBoneCount) == 0;
+
+	if (!bIsSameMapping)
+	{
+		// Skip zero when we wrap around, it is reserved for entries that were never built
+		GTrackToAtomsCache.LastMappingId = FMath::Max<uint32>(GTrackToAtomsCache.LastMappingId + 1, 1);
+		Entry.MappingId = GTrackToAtomsCache.LastMappingId;
+	}
+
+	if (OutMappingId != nullptr)
+	{
+		*OutMappingId = Entry.MappingId;
+	}
+
+	return Entry.TrackToAtomsMap.GetData();
+}
+
+#if ACL_WITH_BIND_POSE_STRIPPING
+/** A bind pose table in ACL track order along with what it was built from. */
+struct FBindPoseCacheEntry
+{
+	// Compressed tracks the table was last built for, along with their hash
+	const acl::compressed_tracks* CompressedClipData = nullptr;
+	uint32 CompressedHash = 0;
+
+	// The skeleton data the table was built from
+	const FTransform* RefPoses = nullptr;
+	const FTrackToSkeletonMap* TrackToSkeletonMap = nullptr;
+	int32 NumRefPoses = 0;
+	int32 NumTrackToSkeletonMap = 0;
+
+	// The cache epoch when the table was built
+	uint32 Epoch = 0;
+
+	TArray<FACLBindPoseTransform> BindPose;
+};
+
+/*
+ * A small direct mapped cache of bind pose tables.
+ * It lives in thread local storage since animations are decompressed in parallel on many threads.
+ */
+struct FBindPoseCache
+{
+	static constexpr uint32 NumEntries = 64;
+
+	FBindPoseCacheEntry Entries[NumEntries];
+};
+
+static thread_local FBindPoseCache GBindPoseCache;
+
+static void BuildBindPoseTable(FBindPoseCacheEntry& Entry, int32 ACLBoneCount, const TArrayView<const FTransform>& RefPoses, const TArrayView<const FTrackToSkeletonMap>& TrackToSkeletonMap)
+{
+	checkf(RefPoses.Num() > 0, TEXT("Reference pose must be provided in the FAnimSequenceDecompressionContext constructor to use bind pose stripping"));
+	checkf(TrackToSkeletonMap.Num() > 0, TEXT("TrackToSkeletonMap must be provided in the FAnimSequenceDecompressionContext constructor to use bind pose stripping"));
+
+	TArray<FACLBindPoseTransform>& BindPose = Entry.BindPose;
+	BindPose.SetNumUninitialized(ACLBoneCount, false);
+
+	const int32 NumMappedTracks = FMath::Min(ACLBoneCount, TrackToSkeletonMap.Num());
+	for (int32 TrackIndex = 0; TrackIndex < NumMappedTracks; ++TrackIndex)
+	{
+		const int32 BoneIndex = TrackToSkeletonMap[TrackIndex].BoneTreeIndex;
+		checkf(RefPoses.IsValidIndex(BoneIndex), TEXT("Invalid bone index: %d"), BoneIndex);
+
+		const FTransform& RefPose = RefPoses[BoneIndex];
+		BindPose[TrackIndex].Rotation = UEQuatToACL(RefPose.GetRotation());
+		BindPose[TrackIndex].Translation = UEVector3ToACL(RefPose.GetTranslation());
+	}
+
+	// Tracks without a skeleton bone can't have had their bind pose stripped, use the identity
+	for (int32 TrackIndex = NumMappedTracks; TrackIndex < ACLBoneCount; ++TrackIndex)
+	{
+		BindPose[TrackIndex].Rotation = rtm::quat_identity();
+		BindPose[TrackIndex].Translation = rtm::vector_zero();
+	}
+}
+
+const FACLBindPoseTransform* GetBindPoseTable(const acl::compressed_tracks& CompressedClipData,
+	const TArrayView<const FTransform>& RefPoses, const TArrayView<const FTrackToSkeletonMap>& TrackToSkeletonMap)
+{
+	const int32 ACLBoneCount = CompressedClipData.get_num_tracks();
+	const uint32 CompressedHash = CompressedClipData.get_hash();
+	const uint32 Epoch = GetDecompressionCacheEpoch();
+
+	// The same sequence can play on different skeletons, use the reference pose to pick our slot
+	uint32 EntryHash = PointerHash(&CompressedClipData);
+	EntryHash = HashCombine(EntryHash, PointerHash(RefPoses.GetData()));
+
+	FBindPoseCacheEntry& Entry = GBindPoseCache.Entries[EntryHash % FBindPoseCache::NumEntries];
+
+	const bool bIsCacheHit = Entry.CompressedClipData == &CompressedClipData &&
+		Entry.CompressedHash == CompressedHash &&
+		Entry.Epoch == Epoch &&
+		Entry.RefPoses == RefPoses.GetData() &&
+		Entry.NumRefPoses == RefPoses.Num() &&
+		Entry.TrackToSkeletonMap == TrackToSkeletonMap.GetData() &&
+		Entry.NumTrackToSkeletonMap == TrackToSkeletonMap.Num() &&
+		Entry.BindPose.Num() == ACLBoneCount;
+
+	if (bIsCacheHit)
+	{
+		CSV_CUSTOM_STAT(ACL, BindPoseCacheHits, 1, ECsvCustomStatOp::Accumulate);
+		return Entry.BindPose.GetData();
+	}
+
+	CSV_CUSTOM_STAT(ACL, BindPoseCacheMisses, 1, ECsvCustomStatOp::Accumulate);
+
+	Entry.CompressedClipData = &CompressedClipData;
+	Entry.CompressedHash = CompressedHash;
+	Entry.RefPoses = RefPoses.GetData();
+	Entry.NumRefPoses = RefPoses.Num();
+	Entry.TrackToSkeletonMap = TrackToSkeletonMap.GetData();
+	Entry.NumTrackToSkeletonMap = TrackToSkeletonMap.Num();
+	Entry.Epoch = Epoch;
+
+	BuildBindPoseTable(Entry, ACLBoneCount, RefPoses, TrackToSkeletonMap);
+
+	return Entry.BindPose.GetData();
+}
+#endif
+
+static TAutoConsoleVariable<int32> CVarACLTemporalCoherence(
+	TEXT("ACL.TemporalCoherence"),
+	0,
+	TEXT("When enabled, the two keyframes that bound the last sampled interval of each sequence are cached and consecutive samples within the same interval only interpolate.\n")
+	TEXT("This is beneficial when the frame rate is higher than the sequence sample rate at the cost of extra memory per worker thread.\n")
+	TEXT("0: Disabled (default)\n")
+	TEXT("1: Enabled"),
+	ECVF_Default);
+
+bool IsTemporalCoherenceEnabled()
+{
+	return CVarACLTemporalCoherence.GetValueOnAnyThread() != 0;
+}
+
+static TAutoConsoleVariable<int32> CVarACLCrowdPoseCache(
+	TEXT("ACL.CrowdPoseCache"),
+	0,
+	TEXT("When enabled, whole poses are shared between instances that play the same sequence at nearly the same time within a frame (e.g. crowds).\n")
+	TEXT("Sample times are quantized with ACL.CrowdPoseCacheTimeStep, instances that sample within the same step output the same pose.\n")
+	TEXT("0: Disabled (default)\n")
+	TEXT("1: Enabled"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarACLCrowdPoseCacheTimeStep(
+	TEXT("ACL.CrowdPoseCacheTimeStep"),
+	1.0f / 60.0f,
+	TEXT("The time step in seconds used to quantize sample times when the crowd pose cache is enabled.\n")
+	TEXT("Larger steps increase how often instances share a pose at the cost of temporal accuracy."),
+	ECVF_Default);
+
+bool IsCrowdPoseCacheEnabled()
+{
+	return CVarACLCrowdPoseCache.GetValueOnAnyThread() != 0;
+}
+
+/** A pose shared between every worker thread. */
+struct FCrowdPoseCacheSlot
+{
+	static constexpr int32 MaxPairs = 512;
+
+	// Even when the slot is stable, odd while a thread writes to it
+	std::atomic<uint32> Sequence{ 0 };
+
+	// The pose we hold, only valid for the frame and cache epoch it was written in
+	// The pair pointers of the key are not retained, the pairs are copied below
+	FACLCrowdPoseKey Key = {};
+	uint64 FrameCounter = ~0ULL;
+	uint32 Epoch = 0;
+
+	// The exact required bones the pose was decompressed with
+	int32 NumRotationPairs = 0;
+	int32 NumTranslationPairs = 0;
+	int32 NumScalePairs = 0;
+
+	BoneTrackPair RotationPairs[MaxPairs];
+	BoneTrackPair TranslationPairs[MaxPairs];
+	BoneTrackPair ScalePairs[MaxPairs];
+
+	// Only the sub-tracks written when decompressing are held, in the order of their pairs
+	FQuat Rotations[MaxPairs];
+	FVector Translations[MaxPairs];
+	FVector Scales[MaxPairs];
+};
+
+/*
+ * A small direct mapped cache of poses shared by every worker thread.
+ * Slots are protected by a sequence lock: writers never wait and give up if another thread writes to the
+ * same slot while readers validate the sequence after copying and treat a concurrent write as a miss.
+ * Entries are only valid for the frame they were written in.
+ *
+ * Like any sequence lock built on plain copies, readers can copy a slot while it is written to. This is formally
+ * a data race under the C++ memory model but it is benign on every platform we support: slots only hold trivially
+ * copyable data, the fences order the sequence loads around the copy, and torn copies are always discarded.
+ * Readers only write the sub-tracks mapped by their pairs and on a miss the decompression overwrites all of them.
+ */
+struct FCrowdPoseCache
+{
+	static constexpr uint32 NumSlots = 32;
+
+	FCrowdPoseCacheSlot Slots[NumSlots];
+
+	FCrowdPoseCacheSlot& GetSlot(const FACLCrowdPoseKey& Key)
+	{
+		uint32 SlotHash = PointerHash(Key.CompressedClipData);
+		SlotHash = HashCombine(SlotHash, GetTypeHash(Key.QuantizedTime));
+		SlotHash = HashCombine(SlotHash, Key.BoneSetHash);
+
+		return Slots[SlotHash % NumSlots];
+	}
+};
+
+// Only allocated once the cache is first used
+static FCrowdPoseCache& GetCrowdPoseCache()
+{
+	static TUniquePtr<FCrowdPoseCache> Cache = MakeUnique<FCrowdPoseCache>();
+	return *Cache;
+}
+
+static uint32 HashBoneTrackPairs(const BoneTrackArray& Pairs, uint32 Crc)
+{
+	return FCrc::MemCrc32(Pairs.GetData(), Pairs.Num() * sizeof(BoneTrackPair), Crc);
+}
+
+static int32 GetNumCrowdPosePairs(const BoneTrackArray* Pairs)
+{
+	return Pairs != nullptr ? Pairs->Num() : 0;
+}
+
+static bool AreCrowdPosePairsEqual(const BoneTrackPair* CachedPairs, int32 NumCachedPairs, const BoneTrackArray* Pairs)
+{
+	const int32 NumPairs = GetNumCrowdPosePairs(Pairs);
+	return NumCachedPairs == NumPairs && (NumPairs == 0 || FMemory::Memcmp(CachedPairs, Pairs->GetData(), NumPairs * sizeof(BoneTrackPair)) == 0);
+}
+
+static bool IsCrowdPoseCacheSlotFor(const FCrowdPoseCacheSlot& Slot, const FACLCrowdPoseKey& Key)
+{
+	// The bone set hash can collide, the pairs are compared as well
+	return Slot.Key.CompressedClipData == Key.CompressedClipData &&
+		Slot.Key.CompressedHash == Key.CompressedHash &&
+		Slot.Key.RefPoses == Key.RefPoses &&
+		Slot.Key.QuantizedTime == Key.QuantizedTime &&
+		Slot.Key.BoneSetHash == Key.BoneSetHash &&
+		Slot.Key.NumAtoms == Key.NumAtoms &&
+		Slot.Key.RoundingPolicy == Key.RoundingPolicy &&
+		AreCrowdPosePairsEqual(Slot.RotationPairs, Slot.NumRotationPairs, Key.RotationPairs) &&
+		AreCrowdPosePairsEqual(Slot.TranslationPairs, Slot.NumTranslationPairs, Key.TranslationPairs) &&
+		AreCrowdPosePairsEqual(Slot.ScalePairs, Slot.NumScalePairs, Key.ScalePairs);
+}
+
+static bool CanCacheCrowdPose(const FACLCrowdPoseKey& Key)
+{
+	return GetNumCrowdPosePairs(Key.RotationPairs) <= FCrowdPoseCacheSlot::MaxPairs &&
+		GetNumCrowdPosePairs(Key.TranslationPairs) <= FCrowdPoseCacheSlot::MaxPairs &&
+		GetNumCrowdPosePairs(Key.ScalePairs) <= FCrowdPoseCacheSlot::MaxPairs;
+}
+
+FACLCrowdPoseKey MakeCrowdPoseKey(const acl::compressed_tracks& CompressedClipData, const FTransform* RefPoses, acl::sample_rounding_policy RoundingPolicy,
+	const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs,
+	int32 NumAtoms, float Time, float& OutQuantizedTime)
+{
+	const float TimeStep = FMath::Max(CVarACLCrowdPoseCacheTimeStep.GetValueOnAnyThread(), 1.0E-4F);
+	const uint32 QuantizedTime = uint32(FMath::RoundToInt(FMath::Max(Time, 0.0f) / TimeStep));
+
+	OutQuantizedTime = float(QuantizedTime) * TimeStep;
+
+	// Sequences without scale never write it, the scale pairs don't change the pose
+	const acl::acl_impl::tracks_header& TracksHeader = acl::acl_impl::get_tracks_header(CompressedClipData);
+	const bool bHasScale = TracksHeader.get_has_scale();
+
+	uint32 BoneSetHash = HashBoneTrackPairs(RotationPairs, 0);
+	BoneSetHash = HashBoneTrackPairs(TranslationPairs, BoneSetHash);
+
+	if (bHasScale)
+	{
+		BoneSetHash = HashBoneTrackPairs(ScalePairs, BoneSetHash);
+	}
+
+	FACLCrowdPoseKey Key;
+	Key.CompressedClipData = &CompressedClipData;
+	Key.CompressedHash = CompressedClipData.get_hash();
+	Key.RefPoses = RefPoses;
+	Key.QuantizedTime = QuantizedTime;
+	Key.BoneSetHash = BoneSetHash;
+	Key.NumAtoms = NumAtoms;
+	Key.RoundingPolicy = RoundingPolicy;
+	Key.RotationPairs = &RotationPairs;
+	Key.TranslationPairs = &TranslationPairs;
+	Key.ScalePairs = bHasScale ? &ScalePairs : nullptr;
+	return Key;
+}
+
+bool FindCrowdPose(const FACLCrowdPoseKey& Key, TArrayView<FTransform>& OutAtoms)
+{
+	if (!CanCacheCrowdPose(Key))
+	{
+		return false;	// Too large to be cached
+	}
+
+	FCrowdPoseCacheSlot& Slot = GetCrowdPoseCache().GetSlot(Key);
+
+	const uint32 Sequence = Slot.Sequence.load(std::memory_order_acquire);
+
+	bool bIsCacheHit = (Sequence & 1) == 0 &&
+		Slot.FrameCounter == uint64(GFrameCounter) &&
+		Slot.Epoch == GetDecompressionCacheEpoch() &&
+		IsCrowdPoseCacheSlotFor(Slot, Key);
+
+	if (bIsCacheHit)
+	{
+		// Only restore what the decompression would have written, other atoms retain the caller's values
+		// See FCrowdPoseCache about concurrent writes
+		int32 PairIndex = 0;
+		for (const BoneTrackPair& Pair : *Key.RotationPairs)
+		{
+			OutAtoms[Pair.AtomIndex].SetRotation(Slot.Rotations[PairIndex++]);
+		}
+
+		PairIndex = 0;
+		for (const BoneTrackPair& Pair : *Key.TranslationPairs)
+		{
+			OutAtoms[Pair.AtomIndex].SetTranslation(Slot.Translations[PairIndex++]);
+		}
+
+		if (Key.ScalePairs != nullptr)
+		{
+			PairIndex = 0;
+			for (const BoneTrackPair& Pair : *Key.ScalePairs)
+			{
+				OutAtoms[Pair.AtomIndex].SetScale3D(Slot.Scales[PairIndex++]);
+			}
+		}
+
+		// If the slot was written to while we copied, what we read is torn and we must decompress ourself
+		std::atomic_thread_fence(std::memory_order_acquire);
+		bIsCacheHit = Slot.Sequence.load(std::memory_order_relaxed) == Sequence;
+	}
+
+	if (bIsCacheHit)
+	{
+		CSV_CUSTOM_STAT(ACL, CrowdPoseCacheHits, 1, ECsvCustomStatOp::Accumulate);
+	}
+	else
+	{
+		CSV_CUSTOM_STAT(ACL, CrowdPoseCacheMisses, 1, ECsvCustomStatOp::Accumulate);
+	}
+
+	return bIsCacheHit;
+}
+
+void StoreCrowdPose(const FACLCrowdPoseKey& Key, const TArrayView<FTransform>& Atoms)
+{
+	if (!CanCacheCrowdPose(Key))
+	{
+		return;	// Too large to be cached
+	}
+
+	FCrowdPoseCacheSlot& Slot = GetCrowdPoseCache().GetSlot(Key);
+
+	// Claim the slot, if another thread is writing to it we don't wait and skip caching our pose
+	uint32 Sequence = Slot.Sequence.load(std::memory_order_relaxed);
+	if ((Sequence & 1) != 0 || !Slot.Sequence.compare_exchange_strong(Sequence, Sequence + 1, std::memory_order_relaxed))
+	{
+		return;
+	}
+
+	// Make sure readers see the slot as being written before any of our writes
+	std::atomic_thread_fence(std::memory_order_release);
+
+	Slot.Key = Key;
+	Slot.Key.RotationPairs = nullptr;
+	Slot.Key.TranslationPairs = nullptr;
+	Slot.Key.ScalePairs = nullptr;
+	Slot.FrameCounter = uint64(GFrameCounter);
+	Slot.Epoch = GetDecompressionCacheEpoch();
+
+	Slot.NumRotationPairs = GetNumCrowdPosePairs(Key.RotationPairs);
+	Slot.NumTranslationPairs = GetNumCrowdPosePairs(Key.TranslationPairs);
+	Slot.NumScalePairs = GetNumCrowdPosePairs(Key.ScalePairs);
+
+	// Only the sub-tracks we decompressed are stored, other atoms hold whatever the caller provided
+	for (int32 PairIndex = 0; PairIndex < Slot.NumRotationPairs; ++PairIndex)
+	{
+		const BoneTrackPair& Pair = (*Key.RotationPairs)[PairIndex];
+		Slot.RotationPairs[PairIndex] = Pair;
+		Slot.Rotations[PairIndex] = Atoms[Pair.AtomIndex].GetRotation();
+	}
+
+	for (int32 PairIndex = 0; PairIndex < Slot.NumTranslationPairs; ++PairIndex)
+	{
+		const BoneTrackPair& Pair = (*Key.TranslationPairs)[PairIndex];
+		Slot.TranslationPairs[PairIndex] = Pair;
+		Slot.Translations[PairIndex] = Atoms[Pair.AtomIndex].GetTranslation();
+	}
+
+	for (int32 PairIndex = 0; PairIndex < Slot.NumScalePairs; ++PairIndex)
+	{
+		const BoneTrackPair& Pair = (*Key.ScalePairs)[PairIndex];
+		Slot.ScalePairs[PairIndex] = Pair;
+		Slot.Scales[PairIndex] = Atoms[Pair.AtomIndex].GetScale3D();
+	}
+
+	Slot.Sequence.store(Sequence + 2, std::memory_order_release);
+}
+
+/*
+ * A small direct mapped cache of decoded keyframes.
+ * Entries are indexed by sequence and interval which allows multiple instances playing the same
+ * sequence at different times to coexist.
+ * It lives in thread local storage since animations are decompressed in parallel on many threads.
+ */
+struct FKeyframeCache
+{
+	static constexpr uint32 NumEntries = 16;
+
+	FACLKeyframeCacheEntry Entries[NumEntries];
+};
+
+static thread_local FKeyframeCache GKeyframeCache;
+
+static uint32 GetKeyframeCacheEntryIndex(const acl::compressed_tracks& CompressedClipData, const FTransform* RefPoses, uint32 MappingId, uint32 Key0)
+{
+	// Different LODs of the same sequence require different tracks, use the mapping to pick our slot
+	uint32 EntryHash = PointerHash(&CompressedClipData);
+	EntryHash = HashCombine(EntryHash, PointerHash(RefPoses));
+	EntryHash = HashCombine(EntryHash, GetTypeHash(MappingId));
+	EntryHash = HashCombine(EntryHash, GetTypeHash(Key0));
+	return EntryHash % FKeyframeCache::NumEntries;
+}
+
+static bool IsKeyframeCacheEntryFor(const FACLKeyframeCacheEntry& Entry, const acl::compressed_tracks& CompressedClipData, const FTransform* RefPoses, uint32 MappingId, uint32 Epoch)
+{
+	// Only the tracks required by the mapping are decoded, a different mapping might require tracks we don't hold
+	return Entry.CompressedClipData == &CompressedClipData &&
+		Entry.CompressedHash == CompressedClipData.get_hash() &&
+		Entry.RefPoses == RefPoses &&
+		Entry.MappingId == MappingId &&
+		Entry.Epoch == Epoch;
+}
+
+FACLKeyframeCacheEntry& FindKeyframeCacheEntry(const acl::compressed_tracks& CompressedClipData, const FTransform* RefPoses,
+	uint32 MappingId, uint32 Key0, uint32 Key1, bool& bOutNeedsKey0, bool& bOutNeedsKey1)
+{
+	const uint32 Epoch = GetDecompressionCacheEpoch();
+
+	FACLKeyframeCacheEntry& Entry = GKeyframeCache.Entries[GetKeyframeCacheEntryIndex(CompressedClipData, RefPoses, MappingId, Key0)];
+
+	if (IsKeyframeCacheEntryFor(Entry, CompressedClipData, RefPoses, MappingId, Epoch) && Entry.Key0 == Key0 && Entry.Key1 == Key1)
+	{
+		CSV_CUSTOM_STAT(ACL, KeyframeCacheHits, 1, ECsvCustomStatOp::Accumulate);
+
+		bOutNeedsKey0 = false;
+		bOutNeedsKey1 = false;
+		return Entry;
+	}
+
+	const int32 ACLBoneCount = CompressedClipData.get_num_tracks();
+
+	Entry.CompressedClipData = &CompressedClipData;
+	Entry.CompressedHash = CompressedClipData.get_hash();
+	Entry.RefPoses = RefPoses;
+	Entry.MappingId = MappingId;
+	Entry.Epoch = Epoch;
+	Entry.Key0 = Key0;
+	Entry.Key1 = Key1;
+	Entry.Pose0.SetNumUninitialized(ACLBoneCount, false);
+	Entry.Pose1.SetNumUninitialized(ACLBoneCount, false);
+
+	bOutNeedsKey0 = true;
+	bOutNeedsKey1 = true;
+
+	// When playing forward, the previous interval ends with our first keyframe
+	if (Key0 != 0)
+	{
+		const FACLKeyframeCacheEntry& PrevEntry = GKeyframeCache.Entries[GetKeyframeCacheEntryIndex(CompressedClipData, RefPoses, MappingId, Key0 - 1)];
+		if (&PrevEntry != &Entry && IsKeyframeCacheEntryFor(PrevEntry, CompressedClipData, RefPoses, MappingId, Epoch) && PrevEntry.Key1 == Key0)
+		{
+			FMemory::Memcpy(Entry.Pose0.GetData(), PrevEntry.Pose1.GetData(), sizeof(FACLKeyframeTransform) * ACLBoneCount);
+			bOutNeedsKey0 = false;
+		}
+	}
+
+	// When playing backward, the next interval starts with our second keyframe
+	if (Key1 != Key0)
+	{
+		const FACLKeyframeCacheEntry& NextEntry = GKeyframeCache.Entries[GetKeyframeCacheEntryIndex(CompressedClipData, RefPoses, MappingId, Key1)];
+		if (&NextEntry != &Entry && IsKeyframeCacheEntryFor(NextEntry, CompressedClipData, RefPoses, MappingId, Epoch) && NextEntry.Key0 == Key1)
+		{
+			FMemory::Memcpy(Entry.Pose1.GetData(), NextEntry.Pose0.GetData(), sizeof(FACLKeyframeTransform) * ACLBoneCount);
+			bOutNeedsKey1 = false;
+		}
+	}
+
+	if (bOutNeedsKey0 && bOutNeedsKey1)
+	{
+		CSV_CUSTOM_STAT(ACL, KeyframeCacheMisses, 1, ECsvCustomStatOp::Accumulate);
+	}
+	else
+	{
+		CSV_CUSTOM_STAT(ACL, KeyframeCachePartialHits, 1, ECsvCustomStatOp::Accumulate);
+	}
+
+	return Entry;
+}
+
+static TAutoConsoleVariable<int32> CVarACLDecompressionLOD(
+	TEXT("ACL.DecompressionLOD"),
+	0,
+	TEXT("When enabled, insignificant poses of linear sequences sample their nearest keyframe instead of interpolating between two keyframes.\n")
+	TEXT("Significance is provided per character with FACLScopedDecompressionSignificance (e.g. from the significance manager).\n")
+	TEXT("0: Disabled (default)\n")
+	TEXT("1: Enabled for poses below ACL.DecompressionLODSignificanceThreshold\n")
+	TEXT("2: Forced for every pose"),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarACLDecompressionLODSignificanceThreshold(
+	TEXT("ACL.DecompressionLODSignificanceThreshold"),
+	0.25f,
+	TEXT("Poses with a significance below this threshold sample their nearest keyframe when ACL.DecompressionLOD is enabled.\n")
+	TEXT("Poses decompressed outside of a FACLScopedDecompressionSignificance scope are fully significant (1.0)."),
+	ECVF_Default);
+
+// The significance of the poses decompressed by this thread, see FACLScopedDecompressionSignificance
+static thread_local float GDecompressionSignificance = 1.0f;
+
+FACLScopedDecompressionSignificance::FACLScopedDecompressionSignificance(float Significance)
+	: PreviousSignificance(GDecompressionSignificance)
+{
+	GDecompressionSignificance = Significance;
+}
+
+FACLScopedDecompressionSignificance::~FACLScopedDecompressionSignificance()
+{
+	GDecompressionSignificance = PreviousSignificance;
+}
+
+acl::sample_rounding_policy get_pose_rounding_policy(EAnimInterpolationType InterpType)
+{
+	if (InterpType == EAnimInterpolationType::Step)
+	{
+		return acl::sample_rounding_policy::floor;
+	}
+
+	const int32 DecompressionLOD = CVarACLDecompressionLOD.GetValueOnAnyThread();
+	if (DecompressionLOD == 0)
+	{
+		return acl::sample_rounding_policy::none;	// Disabled
+	}
+
+	if (DecompressionLOD == 1 && GDecompressionSignificance >= CVarACLDecompressionLODSignificanceThreshold.GetValueOnAnyThread())
+	{
+		return acl::sample_rounding_policy::none;	// Significant enough to interpolate
+	}
+
+	CSV_CUSTOM_STAT(ACL, DecompressionLODNearestKeyframes, 1, ECsvCustomStatOp::Accumulate);
+	return acl::sample_rounding_policy::nearest;
+}
+
+static TAutoConsoleVariable<int32> CVarACLServerBoneSubset(
+	TEXT("ACL.ServerBoneSubset"),
+	1,
+	TEXT("When enabled, sequences compressed with a dedicated server track subset only decompress those tracks (see the ServerBoneNames plugin setting).\n")
+	TEXT("0: Disabled\n")
+	TEXT("1: Enabled on dedicated servers (default)\n")
+	TEXT("2: Forced everywhere, useful to preview what a dedicated server sees"),
+	ECVF_Default);
+
+bool ShouldUseServerTrackSubset()
+{
+	const int32 ServerBoneSubset = CVarACLServerBoneSubset.GetValueOnAnyThread();
+	return ServerBoneSubset == 2 || (ServerBoneSubset == 1 && IsRunningDedicatedServer());
+}
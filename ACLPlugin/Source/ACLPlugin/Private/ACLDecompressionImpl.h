@@ -6,16 +6,34 @@
 #include "Animation/AnimTypes.h"
 #include "AnimEncoding.h"
 #include "CoreMinimal.h"
+#include "ProfilingDebugging/CsvProfiler.h"
 
 #include "ACLImpl.h"
+#include "AnimBoneCompressionCodec_ACLBase.h"
 
 THIRD_PARTY_INCLUDES_START
+#include <acl/core/interpolation_utils.h>
 #include <acl/decompression/decompress.h>
 #include <acl/decompression/database/database.h>
 THIRD_PARTY_INCLUDES_END
 
+CSV_DECLARE_CATEGORY_EXTERN(ACL);
+
+// With large world coordinates, FTransform uses float64 and everything ACL outputs must be converted
+#if defined(UE_LARGE_WORLD_COORDINATES) && UE_LARGE_WORLD_COORDINATES
+	#define ACL_WITH_FLOAT64_OUTPUT 1
+#else
+	#define ACL_WITH_FLOAT64_OUTPUT 0
+#endif
+
 constexpr acl::sample_rounding_policy get_rounding_policy(EAnimInterpolationType InterpType) { return InterpType == EAnimInterpolationType::Step ? acl::sample_rounding_policy::floor : acl::sample_rounding_policy::none; }
 
+/*
+ * Returns the rounding policy to sample a pose with, accounting for the decompression LOD (see ACL.DecompressionLOD).
+ * Insignificant poses of linear sequences sample their nearest keyframe and skip interpolation.
+ */
+acl::sample_rounding_policy get_pose_rounding_policy(EAnimInterpolationType InterpType);
+
 /*
  * The FTransform type does not support setting the members directly from vector types
  * so we derive from it and expose that functionality.
@@ -50,7 +68,114 @@ struct FACLTransform final : public FTransform
 		rtm::vector_store3(Scale_, &Scale3D.X);
 #endif
 	}
+
+#if ACL_WITH_FLOAT64_OUTPUT
+	// Raw access to the float64 components, see FACLFloat64OutputBlock
+	FORCEINLINE_DEBUGGABLE double* GetRotationData() { return reinterpret_cast<double*>(&Rotation); }
+	FORCEINLINE_DEBUGGABLE double* GetTranslationData() { return reinterpret_cast<double*>(&Translation); }
+	FORCEINLINE_DEBUGGABLE double* GetScale3DData() { return reinterpret_cast<double*>(&Scale3D); }
+#endif
+};
+
+#if ACL_WITH_FLOAT64_OUTPUT
+/** Converts the 4 lanes of a float32 vector to float64 with wide conversions (AVX cvtps_pd, SSE2 cvtps_pd x2, NEON fcvtl/fcvtl2) and stores them. */
+FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL StoreFloat64x4(rtm::vector4f_arg0 Value, double* Output)
+{
+#if defined(RTM_AVX_INTRINSICS)
+	_mm256_storeu_pd(Output, _mm256_cvtps_pd(Value));
+#elif defined(RTM_SSE2_INTRINSICS)
+	_mm_storeu_pd(Output, _mm_cvtps_pd(Value));
+	_mm_storeu_pd(Output + 2, _mm_cvtps_pd(_mm_movehl_ps(Value, Value)));
+#elif defined(RTM_NEON64_INTRINSICS)
+	vst1q_f64(Output, vcvt_f64_f32(vget_low_f32(Value)));
+	vst1q_f64(Output + 2, vcvt_high_f64_f32(Value));
+#else
+	Output[0] = rtm::vector_get_x(Value);
+	Output[1] = rtm::vector_get_y(Value);
+	Output[2] = rtm::vector_get_z(Value);
+	Output[3] = rtm::vector_get_w(Value);
+#endif
+}
+
+/** Same as StoreFloat64x4(..) but only the first 3 lanes are stored. */
+FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL StoreFloat64x3(rtm::vector4f_arg0 Value, double* Output)
+{
+#if defined(RTM_SSE2_INTRINSICS)
+	_mm_storeu_pd(Output, _mm_cvtps_pd(Value));
+	_mm_store_sd(Output + 2, _mm_cvtss_sd(_mm_setzero_pd(), _mm_movehl_ps(Value, Value)));
+#elif defined(RTM_NEON64_INTRINSICS)
+	vst1q_f64(Output, vcvt_f64_f32(vget_low_f32(Value)));
+	Output[2] = vgetq_lane_f32(Value, 2);
+#else
+	Output[0] = rtm::vector_get_x(Value);
+	Output[1] = rtm::vector_get_y(Value);
+	Output[2] = rtm::vector_get_z(Value);
+#endif
+}
+
+/*
+ * ACL outputs float32 values that UE5 transforms must store as float64.
+ * Converting each sub-track as it is written interleaves the conversion with the decompression loop.
+ * Instead, the pose writer gathers the float32 values of each sub-track type in its own block and once a block
+ * is full (or the pose is complete), the whole block is converted back to back with wide conversions.
+ * Blocks live inside the writer, no allocation is required.
+ */
+struct FACLFloat64OutputBlock
+{
+	static constexpr int32 Capacity = 32;
+
+	// The float32 values and the output transform index they belong to
+	rtm::vector4f Values[Capacity];
+	uint16 AtomIndices[Capacity];
+	int32 Num = 0;
+
+	FORCEINLINE_DEBUGGABLE bool RTM_SIMD_CALL Add(uint32 AtomIndex, rtm::vector4f_arg0 Value)
+	{
+		Values[Num] = Value;
+		AtomIndices[Num] = (uint16)AtomIndex;
+		return ++Num == Capacity;
+	}
+
+	FORCEINLINE_DEBUGGABLE void FlushRotations(FACLTransform* Atoms)
+	{
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+			StoreFloat64x4(Values[Index], Atoms[AtomIndices[Index]].GetRotationData());
+		}
+
+		Num = 0;
+	}
+
+	// Translations and scales have a zero W lane when transforms are vectorized, like VectorSet_W0
+	FORCEINLINE_DEBUGGABLE void FlushTranslations(FACLTransform* Atoms)
+	{
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+#if PLATFORM_ENABLE_VECTORINTRINSICS || ENABLE_VECTORIZED_TRANSFORM
+			StoreFloat64x4(rtm::vector_set_w(Values[Index], 0.0F), Atoms[AtomIndices[Index]].GetTranslationData());
+#else
+			StoreFloat64x3(Values[Index], Atoms[AtomIndices[Index]].GetTranslationData());
+#endif
+		}
+
+		Num = 0;
+	}
+
+	FORCEINLINE_DEBUGGABLE void FlushScales(FACLTransform* Atoms)
+	{
+		for (int32 Index = 0; Index < Num; ++Index)
+		{
+#if PLATFORM_ENABLE_VECTORINTRINSICS || ENABLE_VECTORIZED_TRANSFORM
+			StoreFloat64x4(rtm::vector_set_w(Values[Index], 0.0F), Atoms[AtomIndices[Index]].GetScale3DData());
+#else
+			StoreFloat64x3(Values[Index], Atoms[AtomIndices[Index]].GetScale3DData());
+#endif
+		}
+
+		Num = 0;
+	}
 };
+#endif
 
 /** These 3 indices map into the output Atom array. */
 struct FAtomIndices
@@ -60,6 +185,217 @@ struct FAtomIndices
 	uint16 Scale;
 };
 
+/** A bind pose value in ACL track order, stored in float32 to be loaded directly when outputting default sub-tracks. */
+struct FACLBindPoseTransform
+{
+	rtm::quatf Rotation;
+	rtm::vector4f Translation;
+};
+
+#if ACL_WITH_BIND_POSE_STRIPPING
+/*
+ * Returns the bind pose of the provided compressed tracks in ACL track order.
+ * The table is built once per sequence and skeleton and cached in thread local storage.
+ * The returned pointer remains valid until the next call on the same thread.
+ */
+const FACLBindPoseTransform* GetBindPoseTable(const acl::compressed_tracks& CompressedClipData,
+	const TArrayView<const FTransform>& RefPoses, const TArrayView<const FTrackToSkeletonMap>& TrackToSkeletonMap);
+#endif
+
+/*
+ * Invalidates every cached decompression state derived from compressed data.
+ * Cached entries are keyed on the compressed tracks pointer and hash, binding new compressed data doesn't require this.
+ * Must be called whenever a database is built, loaded, or destroyed since its contexts aren't covered by that key.
+ */
+void InvalidateDecompressionCaches();
+
+/** Returns the current cache epoch, cached entries built with an older epoch are stale. */
+uint32 GetDecompressionCacheEpoch();
+
+/** An initialized decompression context along with what it was initialized with. */
+template<class DecompressionSettingsType>
+struct TACLPooledDecompressionContext
+{
+	acl::decompression_context<DecompressionSettingsType> Context;
+
+	// The compressed tracks and optional database the context was initialized with
+	// The hash guards against new compressed data living where stale data used to
+	const acl::compressed_tracks* CompressedClipData = nullptr;
+	const void* DatabaseContext = nullptr;
+	uint32 CompressedHash = 0;
+
+	// The cache epoch when the context was initialized
+	uint32 Epoch = 0;
+};
+
+/*
+ * Returns a decompression context from a small direct mapped pool that lives in thread local storage.
+ * Initializing a context parses the compressed headers and validates them. By keeping our contexts
+ * around, this is only done once per sequence instead of every time we decompress.
+ * When bOutNeedsInitialize is true, the caller must validate and initialize the returned context.
+ */
+template<class DecompressionSettingsType>
+FORCEINLINE_DEBUGGABLE acl::decompression_context<DecompressionSettingsType>& GetPooledDecompressionContext(const acl::compressed_tracks* CompressedClipData, const void* DatabaseContext, bool& bOutNeedsInitialize)
+{
+	static constexpr uint32 NumEntries = 32;
+	static thread_local TACLPooledDecompressionContext<DecompressionSettingsType> Pool[NumEntries];
+
+	const uint32 Epoch = GetDecompressionCacheEpoch();
+	const uint32 CompressedHash = CompressedClipData != nullptr ? CompressedClipData->get_hash() : 0;
+	const uint32 EntryHash = HashCombine(PointerHash(CompressedClipData), PointerHash(DatabaseContext));
+
+	TACLPooledDecompressionContext<DecompressionSettingsType>& Entry = Pool[EntryHash % NumEntries];
+
+	const bool bIsCacheHit = Entry.CompressedClipData == CompressedClipData &&
+		Entry.CompressedHash == CompressedHash &&
+		Entry.DatabaseContext == DatabaseContext &&
+		Entry.Epoch == Epoch &&
+		Entry.Context.is_initialized();
+
+	if (bIsCacheHit)
+	{
+		CSV_CUSTOM_STAT(ACL, ContextPoolHits, 1, ECsvCustomStatOp::Accumulate);
+	}
+	else
+	{
+		CSV_CUSTOM_STAT(ACL, ContextPoolMisses, 1, ECsvCustomStatOp::Accumulate);
+
+		Entry.CompressedClipData = CompressedClipData;
+		Entry.DatabaseContext = DatabaseContext;
+		Entry.CompressedHash = CompressedHash;
+		Entry.Epoch = Epoch;
+	}
+
+	bOutNeedsInitialize = !bIsCacheHit;
+	return Entry.Context;
+}
+
+/*
+ * Returns an initialized decompression context for the provided compressed tracks.
+ * The compressed tracks must have been validated beforehand, see FACLCompressedAnimData::bIsDataValid.
+ */
+template<class DecompressionSettingsType>
+FORCEINLINE_DEBUGGABLE acl::decompression_context<DecompressionSettingsType>& GetPooledDecompressionContext(const acl::compressed_tracks* CompressedClipData)
+{
+	bool bNeedsInitialize;
+	acl::decompression_context<DecompressionSettingsType>& ACLContext = GetPooledDecompressionContext<DecompressionSettingsType>(CompressedClipData, nullptr, bNeedsInitialize);
+
+	if (bNeedsInitialize)
+	{
+		checkSlow(CompressedClipData != nullptr && CompressedClipData->is_valid(false).empty());
+
+		ACLContext.initialize(*CompressedClipData);
+	}
+
+	return ACLContext;
+}
+
+/** A decoded keyframe transform in ACL track order. */
+struct FACLKeyframeTransform
+{
+	rtm::quatf Rotation;
+	rtm::vector4f Translation;
+	rtm::vector4f Scale;
+};
+
+/** The two decoded keyframes that bound an interval of a sequence. */
+struct FACLKeyframeCacheEntry
+{
+	// Compressed tracks the keyframes were decoded from, along with their hash
+	const acl::compressed_tracks* CompressedClipData = nullptr;
+	uint32 CompressedHash = 0;
+
+	// The reference pose used to output stripped default sub-tracks, if any
+	const FTransform* RefPoses = nullptr;
+
+	// The cache epoch when the keyframes were decoded
+	uint32 Epoch = 0;
+
+	// The track to atom mapping the keyframes were decoded with, only the tracks it requires hold valid values
+	uint32 MappingId = 0;
+
+	// The keyframes that bound our interval
+	uint32 Key0 = ~0U;
+	uint32 Key1 = ~0U;
+
+	TArray<FACLKeyframeTransform> Pose0;
+	TArray<FACLKeyframeTransform> Pose1;
+};
+
+/** Returns whether or not temporally coherent decompression is enabled (see ACL.TemporalCoherence). */
+bool IsTemporalCoherenceEnabled();
+
+/*
+ * Returns the keyframe cache entry for the provided interval. It lives in thread local storage.
+ * If the entry doesn't already hold the interval, it is reset for it and keyframes held by a neighboring
+ * interval are reused when possible. The caller must decode the keyframes flagged as needed.
+ */
+FACLKeyframeCacheEntry& FindKeyframeCacheEntry(const acl::compressed_tracks& CompressedClipData, const FTransform* RefPoses,
+	uint32 MappingId, uint32 Key0, uint32 Key1, bool& bOutNeedsKey0, bool& bOutNeedsKey1);
+
+/** Identifies a pose in the crowd pose cache. */
+struct FACLCrowdPoseKey
+{
+	// Compressed tracks the pose was decompressed from, along with their hash
+	const acl::compressed_tracks* CompressedClipData;
+	uint32 CompressedHash;
+
+	// The reference pose used to output stripped default sub-tracks, if any
+	const FTransform* RefPoses;
+
+	// The sample time, quantized with the cache time step
+	uint32 QuantizedTime;
+
+	// The hash of the required bones, only used to pick a slot since the pairs themselves are compared
+	uint32 BoneSetHash;
+
+	// The number of output transforms
+	int32 NumAtoms;
+
+	acl::sample_rounding_policy RoundingPolicy;
+
+	// The required bones owned by the caller, only valid while the pose is decompressed
+	// Scale pairs are null when the sequence has no scale since nothing is written for them
+	const BoneTrackArray* RotationPairs;
+	const BoneTrackArray* TranslationPairs;
+	const BoneTrackArray* ScalePairs;
+};
+
+/** Returns whether or not the crowd pose cache is enabled (see ACL.CrowdPoseCache). */
+bool IsCrowdPoseCacheEnabled();
+
+/*
+ * Builds the crowd pose cache key for a pose and returns the quantized time to decompress it at.
+ * Every instance that samples within the same time step shares the same pose.
+ */
+FACLCrowdPoseKey MakeCrowdPoseKey(const acl::compressed_tracks& CompressedClipData, const FTransform* RefPoses, acl::sample_rounding_policy RoundingPolicy,
+	const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs,
+	int32 NumAtoms, float Time, float& OutQuantizedTime);
+
+/*
+ * Copies a pose decompressed earlier this frame into the output transforms, returns false if the cache doesn't hold it.
+ * Only the sub-tracks mapped by the required bones are written, like when the pose is decompressed.
+ * The cache is shared between every worker thread and never blocks: a pose being written is treated as a miss.
+ */
+bool FindCrowdPose(const FACLCrowdPoseKey& Key, TArrayView<FTransform>& OutAtoms);
+
+/** Stores a decompressed pose in the crowd pose cache. Does nothing if another thread is writing to its slot. */
+void StoreCrowdPose(const FACLCrowdPoseKey& Key, const TArrayView<FTransform>& Atoms);
+
+/*
+ * Returns the track to atom mapping for a compressed sequence and the provided set of required bones.
+ * Mappings are cached per thread and identified by the address and size of the required bones, they are rebuilt
+ * once per frame and whenever the required bones change.
+ * The returned pointer remains valid until the next call from the same thread.
+ * If provided, OutMappingId receives an identifier unique to this mapping on this thread, it changes every time a mapping is built.
+ */
+const FAtomIndices* GetTrackToAtomsMap(const acl::compressed_tracks& CompressedClipData,
+	const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs,
+	int32 NumAtoms, uint32* OutMappingId = nullptr);
+
+/** Returns whether or not poses should only decompress their dedicated server track subset (see ACL.ServerBoneSubset). */
+bool ShouldUseServerTrackSubset();
+
 /*
  * Output pose writer that can selectively skip certain tracks.
  */
@@ -68,11 +404,8 @@ struct FUEOutputWriter final : public acl::track_writer
 {
 	// Raw pointer for performance reasons, caller is responsible for ensuring data is valid
 
-	// The bind pose
-	const FTransform* RefPoses;
-
-	// Maps track indices to bone indices
-	const FTrackToSkeletonMap* TrackToBoneMapping;
+	// The bind pose in ACL track order
+	const FACLBindPoseTransform* BindPose;
 
 	// The track to output transform index map
 	const FAtomIndices* TrackToAtomsMap;
@@ -80,20 +413,35 @@ struct FUEOutputWriter final : public acl::track_writer
 	// The output transforms we write
 	FACLTransform* Atoms;
 
+#if ACL_WITH_FLOAT64_OUTPUT
+	// The float32 values waiting to be converted, see FACLFloat64OutputBlock
+	FACLFloat64OutputBlock Rotations;
+	FACLFloat64OutputBlock Translations;
+	FACLFloat64OutputBlock Scales;
+#endif
+
 	FUEOutputWriter(const FAtomIndices* TrackToAtomsMap_, TArrayView<FTransform>& Atoms_)
-		: RefPoses(nullptr)
-		, TrackToBoneMapping(nullptr)
+		: BindPose(nullptr)
 		, TrackToAtomsMap(TrackToAtomsMap_)
 		, Atoms(static_cast<FACLTransform*>(Atoms_.GetData()))
 	{}
 
-	FUEOutputWriter(const TArrayView<const FTransform>& RefPoses_, const TArrayView<const FTrackToSkeletonMap>& TrackToSkeletonMap, const FAtomIndices* TrackToAtomsMap_, TArrayView<FTransform>& Atoms_)
-		: RefPoses(RefPoses_.GetData())
-		, TrackToBoneMapping(TrackToSkeletonMap.GetData())
+	FUEOutputWriter(const FACLBindPoseTransform* BindPose_, const FAtomIndices* TrackToAtomsMap_, TArrayView<FTransform>& Atoms_)
+		: BindPose(BindPose_)
 		, TrackToAtomsMap(TrackToAtomsMap_)
 		, Atoms(static_cast<FACLTransform*>(Atoms_.GetData()))
 	{}
 
+	// Must be called once decompression completes to write out the values that remain to be converted
+	FORCEINLINE_DEBUGGABLE void Flush()
+	{
+#if ACL_WITH_FLOAT64_OUTPUT
+		Rotations.FlushRotations(Atoms);
+		Translations.FlushTranslations(Atoms);
+		Scales.FlushScales(Atoms);
+#endif
+	}
+
 	//////////////////////////////////////////////////////////////////////////
 	// Override the OutputWriter behavior
 	// If we use the bind pose, each default sub-track will grab the bind pose value
@@ -107,15 +455,14 @@ struct FUEOutputWriter final : public acl::track_writer
 	// Always legacy for scale since there is no scale present in the bind pose
 	static constexpr acl::default_sub_track_mode get_default_scale_mode() { return acl::default_sub_track_mode::legacy; }
 
-	// TODO: There is a performance impact here because the ref pose might use doubles on PC
 	FORCEINLINE_DEBUGGABLE rtm::quatf RTM_SIMD_CALL get_variable_default_rotation(uint32_t TrackIndex) const
 	{
-		return UEQuatToACL(RefPoses[TrackToBoneMapping[TrackIndex].BoneTreeIndex].GetRotation());
+		return BindPose[TrackIndex].Rotation;
 	}
 
 	FORCEINLINE_DEBUGGABLE rtm::vector4f RTM_SIMD_CALL get_variable_default_translation(uint32_t TrackIndex) const
 	{
-		return UEVector3ToACL(RefPoses[TrackToBoneMapping[TrackIndex].BoneTreeIndex].GetTranslation());
+		return BindPose[TrackIndex].Translation;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -124,8 +471,15 @@ struct FUEOutputWriter final : public acl::track_writer
 	{
 		const uint32 AtomIndex = TrackToAtomsMap[BoneIndex].Rotation;
 
+#if ACL_WITH_FLOAT64_OUTPUT
+		if (Rotations.Add(AtomIndex, rtm::quat_to_vector(Rotation)))
+		{
+			Rotations.FlushRotations(Atoms);
+		}
+#else
 		FACLTransform& BoneAtom = Atoms[AtomIndex];
 		BoneAtom.SetRotationRaw(Rotation);
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -134,8 +488,15 @@ struct FUEOutputWriter final : public acl::track_writer
 	{
 		const uint32 AtomIndex = TrackToAtomsMap[BoneIndex].Translation;
 
+#if ACL_WITH_FLOAT64_OUTPUT
+		if (Translations.Add(AtomIndex, Translation))
+		{
+			Translations.FlushTranslations(Atoms);
+		}
+#else
 		FACLTransform& BoneAtom = Atoms[AtomIndex];
 		BoneAtom.SetTranslationRaw(Translation);
+#endif
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -144,8 +505,15 @@ struct FUEOutputWriter final : public acl::track_writer
 	{
 		const uint32 AtomIndex = TrackToAtomsMap[BoneIndex].Scale;
 
+#if ACL_WITH_FLOAT64_OUTPUT
+		if (Scales.Add(AtomIndex, Scale))
+		{
+			Scales.FlushScales(Atoms);
+		}
+#else
 		FACLTransform& BoneAtom = Atoms[AtomIndex];
 		BoneAtom.SetScale3DRaw(Scale);
+#endif
 	}
 };
 
@@ -155,24 +523,19 @@ struct FUEOutputWriter final : public acl::track_writer
 template<bool bUseBindPose>
 struct UEOutputTrackWriter final : public acl::track_writer
 {
-	// The bind pose
-	const FTransform* RefPoses;
-
-	// Maps track indices to bone indices
-	const FTrackToSkeletonMap* TrackToBoneMapping;
+	// The bind pose in ACL track order
+	const FACLBindPoseTransform* BindPose;
 
 	// Raw reference for performance reasons, caller is responsible for ensuring data is valid
 	FACLTransform& Atom;
 
 	explicit UEOutputTrackWriter(FTransform& Atom_)
-		: RefPoses(nullptr)
-		, TrackToBoneMapping(nullptr)
+		: BindPose(nullptr)
 		, Atom(static_cast<FACLTransform&>(Atom_))
 	{}
 
-	UEOutputTrackWriter(const TArrayView<const FTransform>& RefPoses_, const TArrayView<const FTrackToSkeletonMap>& TrackToSkeletonMap, FTransform& Atom_)
-		: RefPoses(RefPoses_.GetData())
-		, TrackToBoneMapping(TrackToSkeletonMap.GetData())
+	UEOutputTrackWriter(const FACLBindPoseTransform* BindPose_, FTransform& Atom_)
+		: BindPose(BindPose_)
 		, Atom(static_cast<FACLTransform&>(Atom_))
 	{}
 
@@ -191,15 +554,14 @@ struct UEOutputTrackWriter final : public acl::track_writer
 	// Always legacy for scale since there is no scale present in the bind pose
 	static constexpr acl::default_sub_track_mode get_default_scale_mode() { return acl::default_sub_track_mode::legacy; }
 
-	// TODO: There is a performance impact here because the ref pose might use doubles on PC
 	FORCEINLINE_DEBUGGABLE rtm::quatf RTM_SIMD_CALL get_variable_default_rotation(uint32_t TrackIndex) const
 	{
-		return UEQuatToACL(RefPoses[TrackToBoneMapping[TrackIndex].BoneTreeIndex].GetRotation());
+		return BindPose[TrackIndex].Rotation;
 	}
 
 	FORCEINLINE_DEBUGGABLE rtm::vector4f RTM_SIMD_CALL get_variable_default_translation(uint32_t TrackIndex) const
 	{
-		return UEVector3ToACL(RefPoses[TrackToBoneMapping[TrackIndex].BoneTreeIndex].GetTranslation());
+		return BindPose[TrackIndex].Translation;
 	}
 
 	//////////////////////////////////////////////////////////////////////////
@@ -224,134 +586,991 @@ struct UEOutputTrackWriter final : public acl::track_writer
 	}
 };
 
-template<class ACLContextType>
-FORCEINLINE_DEBUGGABLE void DecompressBone(FAnimSequenceDecompressionContext& DecompContext, ACLContextType& ACLContext, int32 TrackIndex, FTransform& OutAtom)
+/*
+ * A float32 accumulation buffer used to blend several weighted poses together.
+ * Rotations are accumulated along the shortest path and normalized once every pose has been accumulated.
+ * The weight written to each sub-track is tracked: a sample that doesn't write a sub-track (e.g. a bone
+ * without a track or outside of its pairs) retains the caller's value like a standalone DecompressPose(..).
+ */
+struct FACLPoseAccumulator
 {
-#if (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1)
-	const float Time = DecompContext.GetEvaluationTime();
-#else
-	const float Time = DecompContext.Time;
-#endif
+	// Raw pointers for performance reasons, allocated on the FMemStack
+	rtm::quatf* Rotations;
+	rtm::vector4f* Translations;
+	rtm::vector4f* Scales;
 
-	ACLContext.seek(Time, get_rounding_policy(DecompContext.Interpolation));
-
-#if ACL_WITH_BIND_POSE_STRIPPING
-	// See [Bind pose stripping] for details
-	const acl::compressed_tracks* CompressedClipData = ACLContext.get_compressed_tracks();
+	// The sum of the weights written to each sub-track
+	float* RotationWeights;
+	float* TranslationWeights;
+	float* ScaleWeights;
 
-	// Are we non-additive?
-	if (CompressedClipData->get_default_scale() != 0)
-	{
-		// Non-additive anim sequences must write out the bind pose for default sub-tracks since they
-		// have been stripped from the data. Additive anim sequences always have the additive identity
-		// stripped, no need for the bind pose.
-		constexpr bool bUseBindPose = true;
+	// The sum of the weights of every sample accumulated, written or not
+	float TotalWeight;
 
-		checkf(DecompContext.GetRefLocalPoses().Num() > 0, TEXT("Reference pose must be provided in the FAnimSequenceDecompressionContext constructor to use bind pose stripping"));
-		checkf(DecompContext.GetTrackToSkeletonMap().Num() > 0, TEXT("TrackToSkeletonMap must be provided in the FAnimSequenceDecompressionContext constructor to use bind pose stripping"));
+	int32 NumAtoms;
 
-		UEOutputTrackWriter<bUseBindPose> Writer(DecompContext.GetRefLocalPoses(), DecompContext.GetTrackToSkeletonMap(), OutAtom);
-		ACLContext.decompress_track(TrackIndex, Writer);
+	explicit FACLPoseAccumulator(int32 NumAtoms_)
+		: Rotations(new(FMemStack::Get()) rtm::quatf[NumAtoms_])
+		, Translations(new(FMemStack::Get()) rtm::vector4f[NumAtoms_])
+		, Scales(new(FMemStack::Get()) rtm::vector4f[NumAtoms_])
+		, RotationWeights(new(FMemStack::Get()) float[NumAtoms_])
+		, TranslationWeights(new(FMemStack::Get()) float[NumAtoms_])
+		, ScaleWeights(new(FMemStack::Get()) float[NumAtoms_])
+		, TotalWeight(0.0f)
+		, NumAtoms(NumAtoms_)
+	{
+		FMemory::Memzero(Rotations, sizeof(rtm::quatf) * NumAtoms);
+		FMemory::Memzero(Translations, sizeof(rtm::vector4f) * NumAtoms);
+		FMemory::Memzero(Scales, sizeof(rtm::vector4f) * NumAtoms);
+		FMemory::Memzero(RotationWeights, sizeof(float) * NumAtoms);
+		FMemory::Memzero(TranslationWeights, sizeof(float) * NumAtoms);
+		FMemory::Memzero(ScaleWeights, sizeof(float) * NumAtoms);
 	}
-	else
-#endif
+
+	/*
+	 * Writes the blended pose to the output transforms which must hold the caller's pose (e.g. the reference pose).
+	 * Sub-tracks that no sample wrote are left untouched, the others blend in the caller's value with the weight
+	 * of the samples that didn't write them.
+	 */
+	FORCEINLINE_DEBUGGABLE void Flush(TArrayView<FTransform>& InOutAtoms) const
 	{
-		// Additive anim sequences have the identity stripped out, we'll output it.
-		// We also output the regular identity if bind pose stripping isn't enabled.
-		constexpr bool bUseBindPose = false;
+		FACLTransform* Atoms = static_cast<FACLTransform*>(InOutAtoms.GetData());
 
-		UEOutputTrackWriter<bUseBindPose> Writer(OutAtom);
-		ACLContext.decompress_track(TrackIndex, Writer);
+		for (int32 AtomIndex = 0; AtomIndex < NumAtoms; ++AtomIndex)
+		{
+			FACLTransform& Atom = Atoms[AtomIndex];
+
+			if (RotationWeights[AtomIndex] > 0.0f)
+			{
+				rtm::quatf Rotation = Rotations[AtomIndex];
+
+				const float UncoveredWeight = TotalWeight - RotationWeights[AtomIndex];
+				if (UncoveredWeight > 0.0f)
+				{
+					// Same shortest path blending as FUEOutputBlendWriter
+					const rtm::quatf InputRotation = UEQuatToACL(Atom.GetRotation());
+					const float InputWeight = rtm::quat_dot(Rotation, InputRotation) >= 0.0F ? UncoveredWeight : -UncoveredWeight;
+					Rotation = rtm::vector_to_quat(rtm::vector_mul_add(rtm::quat_to_vector(InputRotation), rtm::vector_set(InputWeight), rtm::quat_to_vector(Rotation)));
+				}
+
+				// Opposite rotations can cancel out, retain the caller's rotation if nothing meaningful remains
+				if (rtm::quat_length_squared(Rotation) > 1.0E-8F)
+				{
+					Atom.SetRotationRaw(rtm::quat_normalize(Rotation));
+				}
+			}
+
+			if (TranslationWeights[AtomIndex] > 0.0f)
+			{
+				const float UncoveredWeight = TotalWeight - TranslationWeights[AtomIndex];
+				const rtm::vector4f InputTranslation = UEVector3ToACL(Atom.GetTranslation());
+				Atom.SetTranslationRaw(rtm::vector_mul_add(InputTranslation, rtm::vector_set(FMath::Max(UncoveredWeight, 0.0f)), Translations[AtomIndex]));
+			}
+
+			if (ScaleWeights[AtomIndex] > 0.0f)
+			{
+				const float UncoveredWeight = TotalWeight - ScaleWeights[AtomIndex];
+				const rtm::vector4f InputScale = UEVector3ToACL(Atom.GetScale3D());
+				Atom.SetScale3DRaw(rtm::vector_mul_add(InputScale, rtm::vector_set(FMath::Max(UncoveredWeight, 0.0f)), Scales[AtomIndex]));
+			}
+		}
 	}
-}
+};
 
-template<class ACLContextType>
-FORCEINLINE_DEBUGGABLE void DecompressPose(FAnimSequenceDecompressionContext& DecompContext, ACLContextType& ACLContext,
-	const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs,
-	TArrayView<FTransform>& OutAtoms)
+/*
+ * Output pose writer that accumulates a weighted pose into a FACLPoseAccumulator.
+ * This allows blend spaces and sync groups to blend their samples as they are decompressed
+ * instead of decompressing each sample into a temporary pose first.
+ */
+template<bool bUseBindPose>
+struct FUEOutputBlendWriter final : public acl::track_writer
 {
-#if (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1)
-	const float Time = DecompContext.GetEvaluationTime();
-#else
-	const float Time = DecompContext.Time;
-#endif
+	// Raw pointer for performance reasons, caller is responsible for ensuring data is valid
 
-	// Seek first, we'll start prefetching ahead right away
-	ACLContext.seek(Time, get_rounding_policy(DecompContext.Interpolation));
+	// The bind pose in ACL track order
+	const FACLBindPoseTransform* BindPose;
 
-	const acl::compressed_tracks* CompressedClipData = ACLContext.get_compressed_tracks();
-	const int32 ACLBoneCount = CompressedClipData->get_num_tracks();
+	// The track to output transform index map
+	const FAtomIndices* TrackToAtomsMap;
 
-	// TODO: Allocate this with padding and use SIMD to set everything to 0xFF
-	FAtomIndices* TrackToAtomsMap = new(FMemStack::Get()) FAtomIndices[ACLBoneCount];
-	FMemory::Memset(TrackToAtomsMap, 0xFF, sizeof(FAtomIndices) * ACLBoneCount);
+	// The buffer we accumulate into
+	FACLPoseAccumulator& Accumulator;
 
-	// TODO: We should only need 1x uint16 atom index for each track/bone index
-	// and we need 3 bits to tell whether we care about the rot/trans/scale
-	// The rot and scale pairs are often the same array, skip the scale iteration and set both flags while
-	// iterating on the rotation pairs. This will reduce the mapping size by 2 bytes if we use 4 bytes.
-	// All reads will be aligned, can we pack further with 1x uint16 and 1x uint8 and do unaligned loads?
-	// Need to double check what the ASM looks like on x64 and ARM first to make sure it's good
-	// Maybe having two arrays side by side is better with uint16/uint8? Or having 1 bitset array?
-	// Ultimately, when we load these indices, they will be in the L1 since we write them here just before
-	// we use them during decompression. Optimizing for quick loading/unpacking it best.
+	// The blend weight of our pose, negated to blend rotations along the shortest path
+	rtm::vector4f Weight;
+	rtm::vector4f NegativeWeight;
+	float ScalarWeight;
 
-#if DO_CHECK
-	int32 MinAtomIndex = OutAtoms.Num();
-	int32 MaxAtomIndex = -1;
-	int32 MinTrackIndex = INT_MAX;
-	int32 MaxTrackIndex = -1;
-#endif
+	FUEOutputBlendWriter(const FACLBindPoseTransform* BindPose_, const FAtomIndices* TrackToAtomsMap_, float Weight_, FACLPoseAccumulator& Accumulator_)
+		: BindPose(BindPose_)
+		, TrackToAtomsMap(TrackToAtomsMap_)
+		, Accumulator(Accumulator_)
+		, Weight(rtm::vector_set(Weight_))
+		, NegativeWeight(rtm::vector_set(-Weight_))
+		, ScalarWeight(Weight_)
+	{}
 
-	for (const BoneTrackPair& Pair : RotationPairs)
+	//////////////////////////////////////////////////////////////////////////
+	// Override the OutputWriter behavior
+	// Same default sub-track behavior as FUEOutputWriter
+	FORCEINLINE_DEBUGGABLE bool skip_track_rotation(uint32_t BoneIndex) const { return TrackToAtomsMap[BoneIndex].Rotation == 0xFFFF; }
+	FORCEINLINE_DEBUGGABLE bool skip_track_translation(uint32_t BoneIndex) const { return TrackToAtomsMap[BoneIndex].Translation == 0xFFFF; }
+	FORCEINLINE_DEBUGGABLE bool skip_track_scale(uint32_t BoneIndex) const { return TrackToAtomsMap[BoneIndex].Scale == 0xFFFF; }
+
+	static constexpr acl::default_sub_track_mode get_default_rotation_mode() { return bUseBindPose ? acl::default_sub_track_mode::variable : acl::default_sub_track_mode::constant; }
+	static constexpr acl::default_sub_track_mode get_default_translation_mode() { return bUseBindPose ? acl::default_sub_track_mode::variable : acl::default_sub_track_mode::constant; }
+	static constexpr acl::default_sub_track_mode get_default_scale_mode() { return acl::default_sub_track_mode::legacy; }
+
+	FORCEINLINE_DEBUGGABLE rtm::quatf RTM_SIMD_CALL get_variable_default_rotation(uint32_t TrackIndex) const
 	{
-		TrackToAtomsMap[Pair.TrackIndex].Rotation = (uint16)Pair.AtomIndex;
+		return BindPose[TrackIndex].Rotation;
+	}
 
-#if DO_CHECK
-		MinAtomIndex = FMath::Min(MinAtomIndex, Pair.AtomIndex);
-		MaxAtomIndex = FMath::Max(MaxAtomIndex, Pair.AtomIndex);
-		MinTrackIndex = FMath::Min(MinTrackIndex, Pair.TrackIndex);
-		MaxTrackIndex = FMath::Max(MaxTrackIndex, Pair.TrackIndex);
-#endif
+	FORCEINLINE_DEBUGGABLE rtm::vector4f RTM_SIMD_CALL get_variable_default_translation(uint32_t TrackIndex) const
+	{
+		return BindPose[TrackIndex].Translation;
 	}
 
-	for (const BoneTrackPair& Pair : TranslationPairs)
+	FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL write_rotation(uint32_t BoneIndex, rtm::quatf_arg0 Rotation)
 	{
-		TrackToAtomsMap[Pair.TrackIndex].Translation = (uint16)Pair.AtomIndex;
+		const uint32 AtomIndex = TrackToAtomsMap[BoneIndex].Rotation;
+		const rtm::quatf Accumulated = Accumulator.Rotations[AtomIndex];
 
-#if DO_CHECK
-		MinAtomIndex = FMath::Min(MinAtomIndex, Pair.AtomIndex);
-		MaxAtomIndex = FMath::Max(MaxAtomIndex, Pair.AtomIndex);
-		MinTrackIndex = FMath::Min(MinTrackIndex, Pair.TrackIndex);
-		MaxTrackIndex = FMath::Max(MaxTrackIndex, Pair.TrackIndex);
-#endif
+		// Flip our rotation if it lies in the opposite hemisphere to blend along the shortest path
+		const rtm::vector4f RotationWeight = rtm::quat_dot(Accumulated, Rotation) >= 0.0F ? Weight : NegativeWeight;
+
+		Accumulator.Rotations[AtomIndex] = rtm::vector_to_quat(rtm::vector_mul_add(rtm::quat_to_vector(Rotation), RotationWeight, rtm::quat_to_vector(Accumulated)));
+		Accumulator.RotationWeights[AtomIndex] += ScalarWeight;
 	}
 
-	const acl::acl_impl::tracks_header& TracksHeader = acl::acl_impl::get_tracks_header(*CompressedClipData);
-	if (TracksHeader.get_has_scale())
+	FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL write_translation(uint32_t BoneIndex, rtm::vector4f_arg0 Translation)
 	{
-		for (const BoneTrackPair& Pair : ScalePairs)
-		{
-			TrackToAtomsMap[Pair.TrackIndex].Scale = (uint16)Pair.AtomIndex;
-
-#if DO_CHECK
-			MinAtomIndex = FMath::Min(MinAtomIndex, Pair.AtomIndex);
-			MaxAtomIndex = FMath::Max(MaxAtomIndex, Pair.AtomIndex);
-			MinTrackIndex = FMath::Min(MinTrackIndex, Pair.TrackIndex);
-			MaxTrackIndex = FMath::Max(MaxTrackIndex, Pair.TrackIndex);
-#endif
-		}
+		const uint32 AtomIndex = TrackToAtomsMap[BoneIndex].Translation;
+		Accumulator.Translations[AtomIndex] = rtm::vector_mul_add(Translation, Weight, Accumulator.Translations[AtomIndex]);
+		Accumulator.TranslationWeights[AtomIndex] += ScalarWeight;
 	}
 
-#if DO_CHECK
-	// Only assert once for performance reasons, when we write the pose, we won't perform the checks
-	checkf(OutAtoms.IsValidIndex(MinAtomIndex), TEXT("Invalid atom index: %d"), MinAtomIndex);
-	checkf(OutAtoms.IsValidIndex(MaxAtomIndex), TEXT("Invalid atom index: %d"), MaxAtomIndex);
-	checkf(MinTrackIndex >= 0, TEXT("Invalid track index: %d"), MinTrackIndex);
-	checkf(MaxTrackIndex < ACLBoneCount, TEXT("Invalid track index: %d"), MaxTrackIndex);
-#endif
+	FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL write_scale(uint32_t BoneIndex, rtm::vector4f_arg0 Scale)
+	{
+		const uint32 AtomIndex = TrackToAtomsMap[BoneIndex].Scale;
+		Accumulator.Scales[AtomIndex] = rtm::vector_mul_add(Scale, Weight, Accumulator.Scales[AtomIndex]);
+		Accumulator.ScaleWeights[AtomIndex] += ScalarWeight;
+	}
+};
 
-	// We will decompress the whole pose even if we only care about a smaller subset of bone tracks.
+/*
+ * Output pose writer that applies an additive sequence (in the additive1 format we compress with) on top of
+ * a base pose already present in the output transforms, like FAnimationRuntime::AccumulateAdditivePose(..).
+ * Default sub-tracks are equal to the additive identity and are skipped entirely, an additive layer
+ * only costs its animated sub-tracks.
+ */
+struct FUEOutputAdditiveWriter final : public acl::track_writer
+{
+	// Raw pointer for performance reasons, caller is responsible for ensuring data is valid
+
+	// The track to output transform index map
+	const FAtomIndices* TrackToAtomsMap;
+
+	// The output transforms that contain our base pose
+	FTransform* Atoms;
+
+	// The weight of our additive layer
+	float Weight;
+	bool bIsFullWeight;
+
+	FUEOutputAdditiveWriter(const FAtomIndices* TrackToAtomsMap_, float Weight_, TArrayView<FTransform>& Atoms_)
+		: TrackToAtomsMap(TrackToAtomsMap_)
+		, Atoms(Atoms_.GetData())
+		, Weight(Weight_)
+		, bIsFullWeight(Weight_ == 1.0f)
+	{}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Override the OutputWriter behavior
+	// Default sub-tracks are the additive identity, applying them is a no-op
+	FORCEINLINE_DEBUGGABLE bool skip_track_rotation(uint32_t BoneIndex) const { return TrackToAtomsMap[BoneIndex].Rotation == 0xFFFF; }
+	FORCEINLINE_DEBUGGABLE bool skip_track_translation(uint32_t BoneIndex) const { return TrackToAtomsMap[BoneIndex].Translation == 0xFFFF; }
+	FORCEINLINE_DEBUGGABLE bool skip_track_scale(uint32_t BoneIndex) const { return TrackToAtomsMap[BoneIndex].Scale == 0xFFFF; }
+
+	static constexpr acl::default_sub_track_mode get_default_rotation_mode() { return acl::default_sub_track_mode::skipped; }
+	static constexpr acl::default_sub_track_mode get_default_translation_mode() { return acl::default_sub_track_mode::skipped; }
+	static constexpr acl::default_sub_track_mode get_default_scale_mode() { return acl::default_sub_track_mode::skipped; }
+
+	// The base pose is composed in the output precision, same as FTransform::BlendFromIdentityAndAccumulate(..)
+
+	FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL write_rotation(uint32_t BoneIndex, rtm::quatf_arg0 Rotation)
+	{
+		FQuat AdditiveRotation(rtm::quat_get_x(Rotation), rtm::quat_get_y(Rotation), rtm::quat_get_z(Rotation), rtm::quat_get_w(Rotation));
+		if (!bIsFullWeight)
+		{
+			AdditiveRotation = FQuat::FastLerp(FQuat::Identity, AdditiveRotation, Weight).GetNormalized();
+		}
+
+		FTransform& BoneAtom = Atoms[TrackToAtomsMap[BoneIndex].Rotation];
+		BoneAtom.SetRotation((AdditiveRotation * BoneAtom.GetRotation()).GetNormalized());
+	}
+
+	FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL write_translation(uint32_t BoneIndex, rtm::vector4f_arg0 Translation)
+	{
+		const FVector AdditiveTranslation(rtm::vector_get_x(Translation), rtm::vector_get_y(Translation), rtm::vector_get_z(Translation));
+
+		FTransform& BoneAtom = Atoms[TrackToAtomsMap[BoneIndex].Translation];
+		BoneAtom.AddToTranslation(AdditiveTranslation * Weight);
+	}
+
+	FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL write_scale(uint32_t BoneIndex, rtm::vector4f_arg0 Scale)
+	{
+		// Additive scale is stored as an offset from one
+		const FVector AdditiveScale(rtm::vector_get_x(Scale), rtm::vector_get_y(Scale), rtm::vector_get_z(Scale));
+
+		FTransform& BoneAtom = Atoms[TrackToAtomsMap[BoneIndex].Scale];
+		BoneAtom.MultiplyScale3D(FVector::OneVector + AdditiveScale * Weight);
+	}
+};
+
+/*
+ * Output track writer for a single track of a pose, used when decompressing tracks one at a time.
+ * Each sub-track is written to its own output transform.
+ */
+template<bool bUseBindPose>
+struct FUEOutputPoseTrackWriter final : public acl::track_writer
+{
+	// Raw pointer for performance reasons, caller is responsible for ensuring data is valid
+
+	// The bind pose in ACL track order
+	const FACLBindPoseTransform* BindPose;
+
+	// The output transform indices of the track we decompress, 0xFFFF if a sub-track isn't needed
+	FAtomIndices AtomIndices;
+
+	// The output transforms we write
+	FACLTransform* Atoms;
+
+	FUEOutputPoseTrackWriter(const FACLBindPoseTransform* BindPose_, TArrayView<FTransform>& Atoms_)
+		: BindPose(BindPose_)
+		, AtomIndices{ 0xFFFF, 0xFFFF, 0xFFFF }
+		, Atoms(static_cast<FACLTransform*>(Atoms_.GetData()))
+	{}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Override the OutputWriter behavior
+	// Same default sub-track behavior as FUEOutputWriter
+	FORCEINLINE_DEBUGGABLE bool skip_track_rotation(uint32_t TrackIndex) const { return AtomIndices.Rotation == 0xFFFF; }
+	FORCEINLINE_DEBUGGABLE bool skip_track_translation(uint32_t TrackIndex) const { return AtomIndices.Translation == 0xFFFF; }
+	FORCEINLINE_DEBUGGABLE bool skip_track_scale(uint32_t TrackIndex) const { return AtomIndices.Scale == 0xFFFF; }
+
+	static constexpr acl::default_sub_track_mode get_default_rotation_mode() { return bUseBindPose ? acl::default_sub_track_mode::variable : acl::default_sub_track_mode::constant; }
+	static constexpr acl::default_sub_track_mode get_default_translation_mode() { return bUseBindPose ? acl::default_sub_track_mode::variable : acl::default_sub_track_mode::constant; }
+	static constexpr acl::default_sub_track_mode get_default_scale_mode() { return acl::default_sub_track_mode::legacy; }
+
+	FORCEINLINE_DEBUGGABLE rtm::quatf RTM_SIMD_CALL get_variable_default_rotation(uint32_t TrackIndex) const
+	{
+		return BindPose[TrackIndex].Rotation;
+	}
+
+	FORCEINLINE_DEBUGGABLE rtm::vector4f RTM_SIMD_CALL get_variable_default_translation(uint32_t TrackIndex) const
+	{
+		return BindPose[TrackIndex].Translation;
+	}
+
+	// Single track decompression doesn't always honor the skip functions, we check again when writing
+
+	FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL write_rotation(uint32_t TrackIndex, rtm::quatf_arg0 Rotation)
+	{
+		if (AtomIndices.Rotation != 0xFFFF)
+		{
+			Atoms[AtomIndices.Rotation].SetRotationRaw(Rotation);
+		}
+	}
+
+	FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL write_translation(uint32_t TrackIndex, rtm::vector4f_arg0 Translation)
+	{
+		if (AtomIndices.Translation != 0xFFFF)
+		{
+			Atoms[AtomIndices.Translation].SetTranslationRaw(Translation);
+		}
+	}
+
+	FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL write_scale(uint32_t TrackIndex, rtm::vector4f_arg0 Scale)
+	{
+		if (AtomIndices.Scale != 0xFFFF)
+		{
+			Atoms[AtomIndices.Scale].SetScale3DRaw(Scale);
+		}
+	}
+};
+
+/*
+ * Decompresses the required tracks of a pose among the provided subset one at a time.
+ * The context must already be seeked.
+ */
+template<bool bUseBindPose, class ACLContextType>
+FORCEINLINE_DEBUGGABLE void DecompressPoseTracks(ACLContextType& ACLContext, const FAtomIndices* TrackToAtomsMap, const FACLBindPoseTransform* BindPose, const TArrayView<const uint16> TrackIndices, TArrayView<FTransform>& OutAtoms)
+{
+	FUEOutputPoseTrackWriter<bUseBindPose> Writer(BindPose, OutAtoms);
+
+	for (const uint16 TrackIndex : TrackIndices)
+	{
+		const FAtomIndices& AtomIndices = TrackToAtomsMap[TrackIndex];
+		if ((AtomIndices.Rotation & AtomIndices.Translation & AtomIndices.Scale) == 0xFFFF)
+		{
+			continue;	// Track isn't required
+		}
+
+		Writer.AtomIndices = AtomIndices;
+		ACLContext.decompress_track(TrackIndex, Writer);
+	}
+}
+
+template<class ACLContextType>
+FORCEINLINE_DEBUGGABLE void DecompressBone(FAnimSequenceDecompressionContext& DecompContext, ACLContextType& ACLContext, int32 TrackIndex, FTransform& OutAtom)
+{
+#if (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1)
+	const float Time = DecompContext.GetEvaluationTime();
+#else
+	const float Time = DecompContext.Time;
+#endif
+
+	ACLContext.seek(Time, get_pose_rounding_policy(DecompContext.Interpolation));
+
+#if ACL_WITH_BIND_POSE_STRIPPING
+	// See [Bind pose stripping] for details
+	const acl::compressed_tracks* CompressedClipData = ACLContext.get_compressed_tracks();
+
+	// Are we non-additive?
+	if (CompressedClipData->get_default_scale() != 0)
+	{
+		// Non-additive anim sequences must write out the bind pose for default sub-tracks since they
+		// have been stripped from the data. Additive anim sequences always have the additive identity
+		// stripped, no need for the bind pose.
+		constexpr bool bUseBindPose = true;
+
+		checkf(DecompContext.GetRefLocalPoses().Num() > 0, TEXT("Reference pose must be provided in the FAnimSequenceDecompressionContext constructor to use bind pose stripping"));
+		checkf(DecompContext.GetTrackToSkeletonMap().Num() > 0, TEXT("TrackToSkeletonMap must be provided in the FAnimSequenceDecompressionContext constructor to use bind pose stripping"));
+
+		const FACLBindPoseTransform* BindPose = GetBindPoseTable(*CompressedClipData, DecompContext.GetRefLocalPoses(), DecompContext.GetTrackToSkeletonMap());
+
+		UEOutputTrackWriter<bUseBindPose> Writer(BindPose, OutAtom);
+		ACLContext.decompress_track(TrackIndex, Writer);
+	}
+	else
+#endif
+	{
+		// Additive anim sequences have the identity stripped out, we'll output it.
+		// We also output the regular identity if bind pose stripping isn't enabled.
+		constexpr bool bUseBindPose = false;
+
+		UEOutputTrackWriter<bUseBindPose> Writer(OutAtom);
+		ACLContext.decompress_track(TrackIndex, Writer);
+	}
+}
+
+template<class ACLContextType>
+FORCEINLINE_DEBUGGABLE void DecompressBoneAtTimes(FAnimSequenceDecompressionContext& DecompContext, ACLContextType& ACLContext, int32 TrackIndex, const TArrayView<const float> Times, TArrayView<FTransform> OutAtoms)
+{
+	checkf(Times.Num() == OutAtoms.Num(), TEXT("Each sample time must have a matching output transform"));
+
+	const int32 NumSamples = Times.Num();
+	const acl::sample_rounding_policy RoundingPolicy = get_rounding_policy(DecompContext.Interpolation);
+
+#if ACL_WITH_BIND_POSE_STRIPPING
+	// See [Bind pose stripping] for details
+	const acl::compressed_tracks* CompressedClipData = ACLContext.get_compressed_tracks();
+
+	// Are we non-additive?
+	if (CompressedClipData->get_default_scale() != 0)
+	{
+		// Non-additive anim sequences must write out the bind pose for default sub-tracks since they
+		// have been stripped from the data. Additive anim sequences always have the additive identity
+		// stripped, no need for the bind pose.
+		constexpr bool bUseBindPose = true;
+
+		// Our bind pose doesn't change between samples, look it up once
+		const FACLBindPoseTransform* BindPose = GetBindPoseTable(*CompressedClipData, DecompContext.GetRefLocalPoses(), DecompContext.GetTrackToSkeletonMap());
+
+		for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+		{
+			ACLContext.seek(Times[SampleIndex], RoundingPolicy);
+
+			UEOutputTrackWriter<bUseBindPose> Writer(BindPose, OutAtoms[SampleIndex]);
+			ACLContext.decompress_track(TrackIndex, Writer);
+		}
+	}
+	else
+#endif
+	{
+		// Additive anim sequences have the identity stripped out, we'll output it.
+		// We also output the regular identity if bind pose stripping isn't enabled.
+		constexpr bool bUseBindPose = false;
+
+		for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+		{
+			ACLContext.seek(Times[SampleIndex], RoundingPolicy);
+
+			UEOutputTrackWriter<bUseBindPose> Writer(OutAtoms[SampleIndex]);
+			ACLContext.decompress_track(TrackIndex, Writer);
+		}
+	}
+}
+
+/*
+ * Output pose writer for a subset of tracks, every other track is skipped.
+ */
+template<bool bUseBindPose>
+struct FUEOutputTracksWriter final : public acl::track_writer
+{
+	// Raw pointer for performance reasons, caller is responsible for ensuring data is valid
+
+	// The bind pose in ACL track order
+	const FACLBindPoseTransform* BindPose;
+
+	// The track to output transform index map, 0xFFFF if the track is skipped
+	const uint16* TrackToAtomMap;
+
+	// The output transforms we write
+	FACLTransform* Atoms;
+
+	FUEOutputTracksWriter(const FACLBindPoseTransform* BindPose_, const uint16* TrackToAtomMap_, TArrayView<FTransform>& Atoms_)
+		: BindPose(BindPose_)
+		, TrackToAtomMap(TrackToAtomMap_)
+		, Atoms(static_cast<FACLTransform*>(Atoms_.GetData()))
+	{}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Override the OutputWriter behavior
+	// Same default sub-track behavior as UEOutputTrackWriter
+	FORCEINLINE_DEBUGGABLE bool skip_track_rotation(uint32_t TrackIndex) const { return TrackToAtomMap[TrackIndex] == 0xFFFF; }
+	FORCEINLINE_DEBUGGABLE bool skip_track_translation(uint32_t TrackIndex) const { return TrackToAtomMap[TrackIndex] == 0xFFFF; }
+	FORCEINLINE_DEBUGGABLE bool skip_track_scale(uint32_t TrackIndex) const { return TrackToAtomMap[TrackIndex] == 0xFFFF; }
+
+	static constexpr acl::default_sub_track_mode get_default_rotation_mode() { return bUseBindPose ? acl::default_sub_track_mode::variable : acl::default_sub_track_mode::constant; }
+	static constexpr acl::default_sub_track_mode get_default_translation_mode() { return bUseBindPose ? acl::default_sub_track_mode::variable : acl::default_sub_track_mode::constant; }
+	static constexpr acl::default_sub_track_mode get_default_scale_mode() { return acl::default_sub_track_mode::legacy; }
+
+	FORCEINLINE_DEBUGGABLE rtm::quatf RTM_SIMD_CALL get_variable_default_rotation(uint32_t TrackIndex) const
+	{
+		return BindPose[TrackIndex].Rotation;
+	}
+
+	FORCEINLINE_DEBUGGABLE rtm::vector4f RTM_SIMD_CALL get_variable_default_translation(uint32_t TrackIndex) const
+	{
+		return BindPose[TrackIndex].Translation;
+	}
+
+	FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL write_rotation(uint32_t TrackIndex, rtm::quatf_arg0 Rotation)
+	{
+		Atoms[TrackToAtomMap[TrackIndex]].SetRotationRaw(Rotation);
+	}
+
+	FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL write_translation(uint32_t TrackIndex, rtm::vector4f_arg0 Translation)
+	{
+		Atoms[TrackToAtomMap[TrackIndex]].SetTranslationRaw(Translation);
+	}
+
+	FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL write_scale(uint32_t TrackIndex, rtm::vector4f_arg0 Scale)
+	{
+		Atoms[TrackToAtomMap[TrackIndex]].SetScale3DRaw(Scale);
+	}
+};
+
+/*
+ * Builds a track to output transform mapping on the FMemStack for the requested tracks.
+ * If a track is requested more than once, it maps to its first output transform and bOutHasDuplicates is set.
+ */
+inline const uint16* BuildTrackToAtomMap(int32 ACLBoneCount, const TArrayView<const int32> TrackIndices, bool& bOutHasDuplicates)
+{
+	const int32 NumRequestedTracks = TrackIndices.Num();
+	checkf(NumRequestedTracks < 0xFFFF, TEXT("Too many tracks requested: %d"), NumRequestedTracks);
+
+	uint16* TrackToAtomMap = new(FMemStack::Get()) uint16[ACLBoneCount];
+	FMemory::Memset(TrackToAtomMap, 0xFF, sizeof(uint16) * ACLBoneCount);
+
+	bOutHasDuplicates = false;
+	for (int32 AtomIndex = 0; AtomIndex < NumRequestedTracks; ++AtomIndex)
+	{
+		const int32 TrackIndex = TrackIndices[AtomIndex];
+		checkf(TrackIndex >= 0 && TrackIndex < ACLBoneCount, TEXT("Invalid track index: %d"), TrackIndex);
+
+		if (TrackToAtomMap[TrackIndex] == 0xFFFF)
+		{
+			TrackToAtomMap[TrackIndex] = (uint16)AtomIndex;
+		}
+		else
+		{
+			bOutHasDuplicates = true;
+		}
+	}
+
+	return TrackToAtomMap;
+}
+
+template<class ACLContextType>
+FORCEINLINE_DEBUGGABLE void DecompressBones(FAnimSequenceDecompressionContext& DecompContext, ACLContextType& ACLContext, const TArrayView<const int32> TrackIndices, TArrayView<FTransform> OutAtoms)
+{
+	checkf(TrackIndices.Num() == OutAtoms.Num(), TEXT("Each track index must have a matching output transform"));
+
+	const int32 NumRequestedTracks = TrackIndices.Num();
+	if (NumRequestedTracks == 0)
+	{
+		return;
+	}
+
+#if (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1)
+	const float Time = DecompContext.GetEvaluationTime();
+#else
+	const float Time = DecompContext.Time;
+#endif
+
+	// Seek first, we'll start prefetching ahead right away
+	ACLContext.seek(Time, get_pose_rounding_policy(DecompContext.Interpolation));
+
+	const acl::compressed_tracks* CompressedClipData = ACLContext.get_compressed_tracks();
+	const int32 ACLBoneCount = CompressedClipData->get_num_tracks();
+
+	FMemMark Mark(FMemStack::Get());
+
+	bool bHasDuplicates;
+	const uint16* TrackToAtomMap = BuildTrackToAtomMap(ACLBoneCount, TrackIndices, bHasDuplicates);
+
+	// We decompress the whole pose, skipping the tracks we don't need.
+	// This ensures we read the compressed pose data once, linearly.
+
+#if ACL_WITH_BIND_POSE_STRIPPING
+	// See [Bind pose stripping] for details
+	// Are we non-additive?
+	if (CompressedClipData->get_default_scale() != 0)
+	{
+		// Non-additive anim sequences must write out the bind pose for default sub-tracks since they
+		// have been stripped from the data. Additive anim sequences always have the additive identity
+		// stripped, no need for the bind pose.
+		constexpr bool bUseBindPose = true;
+
+		const FACLBindPoseTransform* BindPose = GetBindPoseTable(*CompressedClipData, DecompContext.GetRefLocalPoses(), DecompContext.GetTrackToSkeletonMap());
+
+		FUEOutputTracksWriter<bUseBindPose> Writer(BindPose, TrackToAtomMap, OutAtoms);
+		ACLContext.decompress_tracks(Writer);
+	}
+	else
+#endif
+	{
+		// Additive anim sequences have the identity stripped out, we'll output it.
+		// We also output the regular identity if bind pose stripping isn't enabled.
+		constexpr bool bUseBindPose = false;
+
+		FUEOutputTracksWriter<bUseBindPose> Writer(nullptr, TrackToAtomMap, OutAtoms);
+		ACLContext.decompress_tracks(Writer);
+	}
+
+	if (bHasDuplicates)
+	{
+		// Copy the transforms of tracks that were requested more than once
+		for (int32 AtomIndex = 0; AtomIndex < NumRequestedTracks; ++AtomIndex)
+		{
+			const int32 DecompressedAtomIndex = TrackToAtomMap[TrackIndices[AtomIndex]];
+			if (DecompressedAtomIndex != AtomIndex)
+			{
+				OutAtoms[AtomIndex] = OutAtoms[DecompressedAtomIndex];
+			}
+		}
+	}
+}
+
+/*
+ * Output pose writer for a subset of tracks in SoA form, every other track is skipped.
+ * Scale isn't written.
+ */
+template<bool bUseBindPose>
+struct FUEOutputSoAWriter final : public acl::track_writer
+{
+	// Raw pointer for performance reasons, caller is responsible for ensuring data is valid
+
+	// The bind pose in ACL track order
+	const FACLBindPoseTransform* BindPose;
+
+	// The track to output index map, 0xFFFF if the track is skipped
+	const uint16* TrackToAtomMap;
+
+	// The output values of the current sample
+	FQuat* Rotations;
+	FVector* Translations;
+
+	FUEOutputSoAWriter(const FACLBindPoseTransform* BindPose_, const uint16* TrackToAtomMap_)
+		: BindPose(BindPose_)
+		, TrackToAtomMap(TrackToAtomMap_)
+		, Rotations(nullptr)
+		, Translations(nullptr)
+	{}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Override the OutputWriter behavior
+	// Same default sub-track behavior as UEOutputTrackWriter
+	FORCEINLINE_DEBUGGABLE bool skip_track_rotation(uint32_t TrackIndex) const { return TrackToAtomMap[TrackIndex] == 0xFFFF; }
+	FORCEINLINE_DEBUGGABLE bool skip_track_translation(uint32_t TrackIndex) const { return TrackToAtomMap[TrackIndex] == 0xFFFF; }
+	static constexpr bool skip_track_scale(uint32_t TrackIndex) { return true; }
+
+	static constexpr acl::default_sub_track_mode get_default_rotation_mode() { return bUseBindPose ? acl::default_sub_track_mode::variable : acl::default_sub_track_mode::constant; }
+	static constexpr acl::default_sub_track_mode get_default_translation_mode() { return bUseBindPose ? acl::default_sub_track_mode::variable : acl::default_sub_track_mode::constant; }
+	static constexpr acl::default_sub_track_mode get_default_scale_mode() { return acl::default_sub_track_mode::skipped; }
+
+	FORCEINLINE_DEBUGGABLE rtm::quatf RTM_SIMD_CALL get_variable_default_rotation(uint32_t TrackIndex) const
+	{
+		return BindPose[TrackIndex].Rotation;
+	}
+
+	FORCEINLINE_DEBUGGABLE rtm::vector4f RTM_SIMD_CALL get_variable_default_translation(uint32_t TrackIndex) const
+	{
+		return BindPose[TrackIndex].Translation;
+	}
+
+	FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL write_rotation(uint32_t TrackIndex, rtm::quatf_arg0 Rotation)
+	{
+		Rotations[TrackToAtomMap[TrackIndex]] = FQuat(rtm::quat_get_x(Rotation), rtm::quat_get_y(Rotation), rtm::quat_get_z(Rotation), rtm::quat_get_w(Rotation));
+	}
+
+	FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL write_translation(uint32_t TrackIndex, rtm::vector4f_arg0 Translation)
+	{
+		Translations[TrackToAtomMap[TrackIndex]] = FVector(rtm::vector_get_x(Translation), rtm::vector_get_y(Translation), rtm::vector_get_z(Translation));
+	}
+
+	FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL write_scale(uint32_t TrackIndex, rtm::vector4f_arg0 Scale)
+	{
+	}
+};
+
+/** Estimates velocities with finite differences between adjacent samples. */
+inline void EstimatePoseSampleVelocities(const TArrayView<const float> Times, int32 NumBones, FACLPoseSamplesSoA& Samples)
+{
+	const int32 NumSamples = Times.Num();
+	const bool bWithLinearVelocities = Samples.LinearVelocities.Num() != 0;
+	const bool bWithAngularVelocities = Samples.AngularVelocities.Num() != 0;
+
+	for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+	{
+		// Use central differences when we can, one sided differences at both ends
+		const int32 PrevSampleIndex = FMath::Max(SampleIndex - 1, 0);
+		const int32 NextSampleIndex = FMath::Min(SampleIndex + 1, NumSamples - 1);
+		const float DeltaTime = Times[NextSampleIndex] - Times[PrevSampleIndex];
+		const float InvDeltaTime = DeltaTime > 0.0f ? (1.0f / DeltaTime) : 0.0f;
+
+		const int32 PrevBase = PrevSampleIndex * NumBones;
+		const int32 NextBase = NextSampleIndex * NumBones;
+		const int32 Base = SampleIndex * NumBones;
+
+		for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+		{
+			if (bWithLinearVelocities)
+			{
+				Samples.LinearVelocities[Base + BoneIndex] = (Samples.Translations[NextBase + BoneIndex] - Samples.Translations[PrevBase + BoneIndex]) * InvDeltaTime;
+			}
+
+			if (bWithAngularVelocities)
+			{
+				FQuat Delta = Samples.Rotations[NextBase + BoneIndex] * Samples.Rotations[PrevBase + BoneIndex].Inverse();
+				Delta.EnforceShortestArcWith(FQuat::Identity);
+
+				FVector Axis;
+				float Angle;
+				Delta.ToAxisAndAngle(Axis, Angle);
+
+				Samples.AngularVelocities[Base + BoneIndex] = Axis * (Angle * InvDeltaTime);
+			}
+		}
+	}
+}
+
+template<class ACLContextType>
+FORCEINLINE_DEBUGGABLE void DecompressBonesAtTimes(FAnimSequenceDecompressionContext& DecompContext, ACLContextType& ACLContext, const TArrayView<const int32> TrackIndices, const TArrayView<const float> Times, FACLPoseSamplesSoA& OutSamples)
+{
+	const int32 NumBones = TrackIndices.Num();
+	const int32 NumSamples = Times.Num();
+	const int32 NumValues = NumBones * NumSamples;
+
+	checkf(OutSamples.Rotations.Num() == NumValues && OutSamples.Translations.Num() == NumValues, TEXT("Each sample must have a matching output value for every bone"));
+	checkf(OutSamples.LinearVelocities.Num() == 0 || OutSamples.LinearVelocities.Num() == NumValues, TEXT("Linear velocities must be empty or have a value for every bone of every sample"));
+	checkf(OutSamples.AngularVelocities.Num() == 0 || OutSamples.AngularVelocities.Num() == NumValues, TEXT("Angular velocities must be empty or have a value for every bone of every sample"));
+
+	if (NumValues == 0)
+	{
+		return;
+	}
+
+	const acl::compressed_tracks* CompressedClipData = ACLContext.get_compressed_tracks();
+	const int32 ACLBoneCount = CompressedClipData->get_num_tracks();
+	const acl::sample_rounding_policy RoundingPolicy = get_rounding_policy(DecompContext.Interpolation);
+
+	FMemMark Mark(FMemStack::Get());
+
+	// Our mapping and bind pose don't change between samples, we only build them once
+	bool bHasDuplicates;
+	const uint16* TrackToAtomMap = BuildTrackToAtomMap(ACLBoneCount, TrackIndices, bHasDuplicates);
+
+	// Sorted sample times are best, we decompress each sample in order with the same context
+	// and consecutive seeks read neighboring compressed data
+	auto DecompressSamples = [&](auto& Writer)
+	{
+		for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+		{
+			ACLContext.seek(Times[SampleIndex], RoundingPolicy);
+
+			Writer.Rotations = OutSamples.Rotations.GetData() + SampleIndex * NumBones;
+			Writer.Translations = OutSamples.Translations.GetData() + SampleIndex * NumBones;
+			ACLContext.decompress_tracks(Writer);
+		}
+	};
+
+#if ACL_WITH_BIND_POSE_STRIPPING
+	// See [Bind pose stripping] for details
+	// Are we non-additive?
+	if (CompressedClipData->get_default_scale() != 0)
+	{
+		const FACLBindPoseTransform* BindPose = GetBindPoseTable(*CompressedClipData, DecompContext.GetRefLocalPoses(), DecompContext.GetTrackToSkeletonMap());
+
+		FUEOutputSoAWriter<true> Writer(BindPose, TrackToAtomMap);
+		DecompressSamples(Writer);
+	}
+	else
+#endif
+	{
+		FUEOutputSoAWriter<false> Writer(nullptr, TrackToAtomMap);
+		DecompressSamples(Writer);
+	}
+
+	if (bHasDuplicates)
+	{
+		// Copy the values of tracks that were requested more than once
+		for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+		{
+			const int32 Base = SampleIndex * NumBones;
+			for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+			{
+				const int32 DecompressedBoneIndex = TrackToAtomMap[TrackIndices[BoneIndex]];
+				if (DecompressedBoneIndex != BoneIndex)
+				{
+					OutSamples.Rotations[Base + BoneIndex] = OutSamples.Rotations[Base + DecompressedBoneIndex];
+					OutSamples.Translations[Base + BoneIndex] = OutSamples.Translations[Base + DecompressedBoneIndex];
+				}
+			}
+		}
+	}
+
+	if (OutSamples.LinearVelocities.Num() != 0 || OutSamples.AngularVelocities.Num() != 0)
+	{
+		EstimatePoseSampleVelocities(Times, NumBones, OutSamples);
+	}
+}
+
+/*
+ * Output pose writer that writes the required tracks of a keyframe in ACL track order.
+ */
+template<bool bUseBindPose>
+struct FACLKeyframeWriter final : public acl::track_writer
+{
+	// The bind pose in ACL track order
+	const FACLBindPoseTransform* BindPose;
+
+	// Tracks that aren't mapped to an atom are skipped
+	const FAtomIndices* TrackToAtomsMap;
+
+	// The keyframe we write
+	FACLKeyframeTransform* Pose;
+
+	FACLKeyframeWriter(const FACLBindPoseTransform* BindPose_, const FAtomIndices* TrackToAtomsMap_, FACLKeyframeTransform* Pose_)
+		: BindPose(BindPose_)
+		, TrackToAtomsMap(TrackToAtomsMap_)
+		, Pose(Pose_)
+	{}
+
+	//////////////////////////////////////////////////////////////////////////
+	// Override the OutputWriter behavior
+	FORCEINLINE_DEBUGGABLE bool skip_track_rotation(uint32_t TrackIndex) const { return TrackToAtomsMap[TrackIndex].Rotation == 0xFFFF; }
+	FORCEINLINE_DEBUGGABLE bool skip_track_translation(uint32_t TrackIndex) const { return TrackToAtomsMap[TrackIndex].Translation == 0xFFFF; }
+	FORCEINLINE_DEBUGGABLE bool skip_track_scale(uint32_t TrackIndex) const { return TrackToAtomsMap[TrackIndex].Scale == 0xFFFF; }
+
+	// Same default sub-track behavior as FUEOutputWriter
+	static constexpr acl::default_sub_track_mode get_default_rotation_mode() { return bUseBindPose ? acl::default_sub_track_mode::variable : acl::default_sub_track_mode::constant; }
+	static constexpr acl::default_sub_track_mode get_default_translation_mode() { return bUseBindPose ? acl::default_sub_track_mode::variable : acl::default_sub_track_mode::constant; }
+	static constexpr acl::default_sub_track_mode get_default_scale_mode() { return acl::default_sub_track_mode::legacy; }
+
+	FORCEINLINE_DEBUGGABLE rtm::quatf RTM_SIMD_CALL get_variable_default_rotation(uint32_t TrackIndex) const
+	{
+		return BindPose[TrackIndex].Rotation;
+	}
+
+	FORCEINLINE_DEBUGGABLE rtm::vector4f RTM_SIMD_CALL get_variable_default_translation(uint32_t TrackIndex) const
+	{
+		return BindPose[TrackIndex].Translation;
+	}
+
+	FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL write_rotation(uint32_t TrackIndex, rtm::quatf_arg0 Rotation)
+	{
+		Pose[TrackIndex].Rotation = Rotation;
+	}
+
+	FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL write_translation(uint32_t TrackIndex, rtm::vector4f_arg0 Translation)
+	{
+		Pose[TrackIndex].Translation = Translation;
+	}
+
+	FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL write_scale(uint32_t TrackIndex, rtm::vector4f_arg0 Scale)
+	{
+		Pose[TrackIndex].Scale = Scale;
+	}
+};
+
+template<bool bUseBindPose, class ACLContextType>
+FORCEINLINE_DEBUGGABLE void DecodeKeyframe(ACLContextType& ACLContext, float SampleRate, uint32 Key, const FACLBindPoseTransform* BindPose, const FAtomIndices* TrackToAtomsMap, TArray<FACLKeyframeTransform>& OutPose)
+{
+	// Seek exactly on our keyframe, rounding to the nearest sample guards against floating point imprecision
+	ACLContext.seek(float(Key) / SampleRate, acl::sample_rounding_policy::nearest);
+
+	FACLKeyframeWriter<bUseBindPose> Writer(BindPose, TrackToAtomsMap, OutPose.GetData());
+	ACLContext.decompress_tracks(Writer);
+}
+
+/*
+ * Decompresses a pose by interpolating between the two keyframes that bound our sample time.
+ * Both keyframes are cached and while consecutive calls sample within the same interval (e.g. rendering at
+ * a higher rate than the sequence sample rate), we only interpolate. When the playhead moves to the next
+ * interval, the keyframe they share is reused and we only decode one keyframe.
+ * Only the required tracks are decoded, keyframes are cached per track to atom mapping.
+ * Returns false if the sequence cannot be decompressed this way.
+ */
+template<class ACLContextType>
+FORCEINLINE_DEBUGGABLE bool DecompressPoseCoherent(FAnimSequenceDecompressionContext& DecompContext, ACLContextType& ACLContext, float Time,
+	const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs,
+	TArrayView<FTransform>& OutAtoms)
+{
+	const acl::compressed_tracks* CompressedClipData = ACLContext.get_compressed_tracks();
+
+	const uint32 NumSamples = CompressedClipData->get_num_samples_per_track();
+	const float SampleRate = CompressedClipData->get_sample_rate();
+	if (NumSamples <= 1 || SampleRate <= 0.0f)
+	{
+		return false;	// Nothing to interpolate
+	}
+
+	const acl::sample_looping_policy LoopingPolicy = CompressedClipData->get_looping_policy();
+	if (LoopingPolicy == acl::sample_looping_policy::wrap)
+	{
+		// The last interval of a wrapping sequence interpolates with the first keyframe, let ACL handle it
+		return false;
+	}
+
+	// Find our interval the same way the decompression context does when it seeks
+	const float Duration = float(NumSamples - 1) / SampleRate;
+	const float SampleTime = FMath::Clamp(Time, 0.0f, Duration);
+
+	uint32 Key0;
+	uint32 Key1;
+	float Alpha;
+	acl::find_linear_interpolation_samples_with_sample_rate(NumSamples, SampleRate, SampleTime, acl::sample_rounding_policy::none, LoopingPolicy, Key0, Key1, Alpha);
+
+	// The mapping only depends on the required bones, it is cached and only rebuilt when they change
+	uint32 MappingId;
+	const FAtomIndices* TrackToAtomsMap = GetTrackToAtomsMap(*CompressedClipData, RotationPairs, TranslationPairs, ScalePairs, OutAtoms.Num(), &MappingId);
+
+	const FACLBindPoseTransform* BindPose = nullptr;
+	const FTransform* RefPoses = nullptr;
+
+#if ACL_WITH_BIND_POSE_STRIPPING
+	// See [Bind pose stripping] for details
+	// Non-additive sequences output the bind pose for stripped default sub-tracks
+	const bool bUseBindPose = CompressedClipData->get_default_scale() != 0;
+	if (bUseBindPose)
+	{
+		BindPose = GetBindPoseTable(*CompressedClipData, DecompContext.GetRefLocalPoses(), DecompContext.GetTrackToSkeletonMap());
+		RefPoses = DecompContext.GetRefLocalPoses().GetData();
+	}
+#endif
+
+	bool bNeedsKey0;
+	bool bNeedsKey1;
+	FACLKeyframeCacheEntry& Entry = FindKeyframeCacheEntry(*CompressedClipData, RefPoses, MappingId, Key0, Key1, bNeedsKey0, bNeedsKey1);
+
+	if (bNeedsKey0 || bNeedsKey1)
+	{
+#if ACL_WITH_BIND_POSE_STRIPPING
+		if (bUseBindPose)
+		{
+			if (bNeedsKey0)
+			{
+				DecodeKeyframe<true>(ACLContext, SampleRate, Key0, BindPose, TrackToAtomsMap, Entry.Pose0);
+			}
+
+			if (bNeedsKey1)
+			{
+				DecodeKeyframe<true>(ACLContext, SampleRate, Key1, BindPose, TrackToAtomsMap, Entry.Pose1);
+			}
+		}
+		else
+#endif
+		{
+			if (bNeedsKey0)
+			{
+				DecodeKeyframe<false>(ACLContext, SampleRate, Key0, BindPose, TrackToAtomsMap, Entry.Pose0);
+			}
+
+			if (bNeedsKey1)
+			{
+				DecodeKeyframe<false>(ACLContext, SampleRate, Key1, BindPose, TrackToAtomsMap, Entry.Pose1);
+			}
+		}
+	}
+
+	// Interpolate only the tracks we need
+	const FACLKeyframeTransform* Pose0 = Entry.Pose0.GetData();
+	const FACLKeyframeTransform* Pose1 = Entry.Pose1.GetData();
+	FACLTransform* Atoms = static_cast<FACLTransform*>(OutAtoms.GetData());
+
+	for (const BoneTrackPair& Pair : RotationPairs)
+	{
+		const rtm::quatf Rotation = rtm::quat_lerp(Pose0[Pair.TrackIndex].Rotation, Pose1[Pair.TrackIndex].Rotation, Alpha);
+		Atoms[Pair.AtomIndex].SetRotationRaw(Rotation);
+	}
+
+	for (const BoneTrackPair& Pair : TranslationPairs)
+	{
+		const rtm::vector4f Translation = rtm::vector_lerp(Pose0[Pair.TrackIndex].Translation, Pose1[Pair.TrackIndex].Translation, Alpha);
+		Atoms[Pair.AtomIndex].SetTranslationRaw(Translation);
+	}
+
+	const acl::acl_impl::tracks_header& TracksHeader = acl::acl_impl::get_tracks_header(*CompressedClipData);
+	if (TracksHeader.get_has_scale())
+	{
+		for (const BoneTrackPair& Pair : ScalePairs)
+		{
+			const rtm::vector4f Scale = rtm::vector_lerp(Pose0[Pair.TrackIndex].Scale, Pose1[Pair.TrackIndex].Scale, Alpha);
+			Atoms[Pair.AtomIndex].SetScale3DRaw(Scale);
+		}
+	}
+
+	return true;
+}
+
+/** Decompresses a whole pose at the provided sample time. */
+template<class ACLContextType>
+FORCEINLINE_DEBUGGABLE void DecompressPoseAtTime(FAnimSequenceDecompressionContext& DecompContext, ACLContextType& ACLContext, float Time, acl::sample_rounding_policy RoundingPolicy,
+	const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs,
+	TArrayView<FTransform>& OutAtoms)
+{
+	// Stepped interpolation and the decompression LOD always land on a keyframe, they gain nothing from temporal coherence
+	if (RoundingPolicy == acl::sample_rounding_policy::none && IsTemporalCoherenceEnabled())
+	{
+		if (DecompressPoseCoherent(DecompContext, ACLContext, Time, RotationPairs, TranslationPairs, ScalePairs, OutAtoms))
+		{
+			return;
+		}
+	}
+
+	// Seek first, we'll start prefetching ahead right away
+	ACLContext.seek(Time, RoundingPolicy);
+
+	const acl::compressed_tracks* CompressedClipData = ACLContext.get_compressed_tracks();
+
+	// The mapping only depends on the required bones, it is cached and only rebuilt when they change
+	const FAtomIndices* TrackToAtomsMap = GetTrackToAtomsMap(*CompressedClipData, RotationPairs, TranslationPairs, ScalePairs, OutAtoms.Num());
+
+	// We will decompress the whole pose even if we only care about a smaller subset of bone tracks.
 	// This ensures we read the compressed pose data once, linearly.
 
 #if ACL_WITH_BIND_POSE_STRIPPING
@@ -364,8 +1583,11 @@ FORCEINLINE_DEBUGGABLE void DecompressPose(FAnimSequenceDecompressionContext& De
 		// stripped, no need for the bind pose.
 		constexpr bool bUseBindPose = true;
 
-		FUEOutputWriter<bUseBindPose> PoseWriter(DecompContext.GetRefLocalPoses(), DecompContext.GetTrackToSkeletonMap(), TrackToAtomsMap, OutAtoms);
+		const FACLBindPoseTransform* BindPose = GetBindPoseTable(*CompressedClipData, DecompContext.GetRefLocalPoses(), DecompContext.GetTrackToSkeletonMap());
+
+		FUEOutputWriter<bUseBindPose> PoseWriter(BindPose, TrackToAtomsMap, OutAtoms);
 		ACLContext.decompress_tracks(PoseWriter);
+		PoseWriter.Flush();
 	}
 	else
 #endif
@@ -376,5 +1598,251 @@ FORCEINLINE_DEBUGGABLE void DecompressPose(FAnimSequenceDecompressionContext& De
 
 		FUEOutputWriter<bUseBindPose> PoseWriter(TrackToAtomsMap, OutAtoms);
 		ACLContext.decompress_tracks(PoseWriter);
+		PoseWriter.Flush();
+	}
+}
+
+template<class ACLContextType>
+FORCEINLINE_DEBUGGABLE void DecompressPose(FAnimSequenceDecompressionContext& DecompContext, ACLContextType& ACLContext,
+	const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs,
+	TArrayView<FTransform>& OutAtoms)
+{
+#if (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1)
+	const float Time = DecompContext.GetEvaluationTime();
+#else
+	const float Time = DecompContext.Time;
+#endif
+
+	const acl::sample_rounding_policy RoundingPolicy = get_pose_rounding_policy(DecompContext.Interpolation);
+
+	if (!IsCrowdPoseCacheEnabled())
+	{
+		DecompressPoseAtTime(DecompContext, ACLContext, Time, RoundingPolicy, RotationPairs, TranslationPairs, ScalePairs, OutAtoms);
+		return;
+	}
+
+	const acl::compressed_tracks* CompressedClipData = ACLContext.get_compressed_tracks();
+
+#if ACL_WITH_BIND_POSE_STRIPPING
+	// The output of non-additive sequences depends on the bind pose, see [Bind pose stripping] for details
+	const FTransform* RefPoses = CompressedClipData->get_default_scale() != 0 ? DecompContext.GetRefLocalPoses().GetData() : nullptr;
+#else
+	const FTransform* RefPoses = nullptr;
+#endif
+
+	// Instances that sample the same sequence within the same time step this frame share their pose
+	float QuantizedTime;
+	const FACLCrowdPoseKey Key = MakeCrowdPoseKey(*CompressedClipData, RefPoses, RoundingPolicy, RotationPairs, TranslationPairs, ScalePairs, OutAtoms.Num(), Time, QuantizedTime);
+
+	if (FindCrowdPose(Key, OutAtoms))
+	{
+		return;
+	}
+
+	DecompressPoseAtTime(DecompContext, ACLContext, QuantizedTime, RoundingPolicy, RotationPairs, TranslationPairs, ScalePairs, OutAtoms);
+
+	StoreCrowdPose(Key, OutAtoms);
+}
+
+/*
+ * Decompresses only the tracks of a pose that dedicated servers require (see UACLPluginSettings::ServerBoneNames).
+ * Output transforms of other tracks are left untouched and retain the reference pose.
+ */
+template<class ACLContextType>
+FORCEINLINE_DEBUGGABLE void DecompressPoseServerSubset(FAnimSequenceDecompressionContext& DecompContext, ACLContextType& ACLContext, const TArrayView<const uint16> ServerTrackIndices,
+	const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs,
+	TArrayView<FTransform>& OutAtoms)
+{
+#if (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1)
+	const float Time = DecompContext.GetEvaluationTime();
+#else
+	const float Time = DecompContext.Time;
+#endif
+
+	// Seek first, we'll start prefetching ahead right away
+	ACLContext.seek(Time, get_pose_rounding_policy(DecompContext.Interpolation));
+
+	const acl::compressed_tracks* CompressedClipData = ACLContext.get_compressed_tracks();
+
+	const FAtomIndices* TrackToAtomsMap = GetTrackToAtomsMap(*CompressedClipData, RotationPairs, TranslationPairs, ScalePairs, OutAtoms.Num());
+
+	CSV_CUSTOM_STAT(ACL, PoseServerSubsetDecompressions, 1, ECsvCustomStatOp::Accumulate);
+
+#if ACL_WITH_BIND_POSE_STRIPPING
+	// See [Bind pose stripping] for details
+	if (CompressedClipData->get_default_scale() != 0)
+	{
+		const FACLBindPoseTransform* BindPose = GetBindPoseTable(*CompressedClipData, DecompContext.GetRefLocalPoses(), DecompContext.GetTrackToSkeletonMap());
+		DecompressPoseTracks<true>(ACLContext, TrackToAtomsMap, BindPose, ServerTrackIndices, OutAtoms);
+	}
+	else
+#endif
+	{
+		DecompressPoseTracks<false>(ACLContext, TrackToAtomsMap, nullptr, ServerTrackIndices, OutAtoms);
+	}
+}
+
+template<class ACLContextType>
+FORCEINLINE_DEBUGGABLE void AccumulatePose(FAnimSequenceDecompressionContext& DecompContext, ACLContextType& ACLContext,
+	const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs,
+	float Weight, FACLPoseAccumulator& Accumulator)
+{
+#if (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1)
+	const float Time = DecompContext.GetEvaluationTime();
+#else
+	const float Time = DecompContext.Time;
+#endif
+
+	// Seek first, we'll start prefetching ahead right away
+	ACLContext.seek(Time, get_pose_rounding_policy(DecompContext.Interpolation));
+
+	const acl::compressed_tracks* CompressedClipData = ACLContext.get_compressed_tracks();
+
+	const FAtomIndices* TrackToAtomsMap = GetTrackToAtomsMap(*CompressedClipData, RotationPairs, TranslationPairs, ScalePairs, Accumulator.NumAtoms);
+
+#if ACL_WITH_BIND_POSE_STRIPPING
+	// See [Bind pose stripping] for details
+	// Are we non-additive?
+	if (CompressedClipData->get_default_scale() != 0)
+	{
+		constexpr bool bUseBindPose = true;
+
+		const FACLBindPoseTransform* BindPose = GetBindPoseTable(*CompressedClipData, DecompContext.GetRefLocalPoses(), DecompContext.GetTrackToSkeletonMap());
+
+		FUEOutputBlendWriter<bUseBindPose> Writer(BindPose, TrackToAtomsMap, Weight, Accumulator);
+		ACLContext.decompress_tracks(Writer);
+	}
+	else
+#endif
+	{
+		constexpr bool bUseBindPose = false;
+
+		FUEOutputBlendWriter<bUseBindPose> Writer(nullptr, TrackToAtomsMap, Weight, Accumulator);
+		ACLContext.decompress_tracks(Writer);
 	}
 }
+
+template<class ACLContextType>
+FORCEINLINE_DEBUGGABLE void ApplyAdditivePose(FAnimSequenceDecompressionContext& DecompContext, ACLContextType& ACLContext,
+	const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs,
+	float Weight, TArrayView<FTransform>& InOutAtoms)
+{
+	if (Weight == 0.0f)
+	{
+		return;	// Doesn't contribute
+	}
+
+#if (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1)
+	const float Time = DecompContext.GetEvaluationTime();
+#else
+	const float Time = DecompContext.Time;
+#endif
+
+	// Seek first, we'll start prefetching ahead right away
+	ACLContext.seek(Time, get_pose_rounding_policy(DecompContext.Interpolation));
+
+	const acl::compressed_tracks* CompressedClipData = ACLContext.get_compressed_tracks();
+	checkf(CompressedClipData->get_default_scale() == 0, TEXT("Only additive anim sequences can be applied onto a base pose"));
+
+	const FAtomIndices* TrackToAtomsMap = GetTrackToAtomsMap(*CompressedClipData, RotationPairs, TranslationPairs, ScalePairs, InOutAtoms.Num());
+
+	FUEOutputAdditiveWriter Writer(TrackToAtomsMap, Weight, InOutAtoms);
+	ACLContext.decompress_tracks(Writer);
+}
+
+/*
+ * The decompression entry points shared by every ACL codec, they only differ by their decompression settings.
+ * Codecs forward to them with the decompression context of the sequence. A null context means the compressed
+ * data is invalid and nothing is decompressed, yielding a T-pose.
+ */
+template<class DecompressionSettingsType>
+struct TACLCodecDecompression
+{
+	using ContextType = acl::decompression_context<DecompressionSettingsType>;
+
+	/** Returns the pooled decompression context of a sequence that owns its compressed data (see FACLCompressedAnimData), nullptr if its data is invalid. */
+	static FORCEINLINE_DEBUGGABLE ContextType* GetPooledContext(const FAnimSequenceDecompressionContext& DecompContext)
+	{
+		const FACLCompressedAnimData& AnimData = static_cast<const FACLCompressedAnimData&>(DecompContext.CompressedAnimData);
+		if (!AnimData.bIsDataValid)
+		{
+			return nullptr;
+		}
+
+		return &GetPooledDecompressionContext<DecompressionSettingsType>(AnimData.GetCompressedTracks());
+	}
+
+	/** Returns the dedicated server track subset of a sequence that owns its compressed data, nullptr if it has none or it shouldn't be used. */
+	static FORCEINLINE_DEBUGGABLE const TArrayView<const uint16>* GetServerTrackIndices(const FAnimSequenceDecompressionContext& DecompContext)
+	{
+		const FACLCompressedAnimData& AnimData = static_cast<const FACLCompressedAnimData&>(DecompContext.CompressedAnimData);
+		return AnimData.bHasServerTrackSubset && ShouldUseServerTrackSubset() ? &AnimData.ServerTrackIndices : nullptr;
+	}
+
+	static FORCEINLINE_DEBUGGABLE void DecompressPose(FAnimSequenceDecompressionContext& DecompContext, ContextType* ACLContext, const TArrayView<const uint16>* ServerTrackIndices,
+		const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, TArrayView<FTransform>& OutAtoms)
+	{
+		if (ACLContext == nullptr)
+		{
+			return;
+		}
+
+		if (ServerTrackIndices != nullptr)
+		{
+			::DecompressPoseServerSubset(DecompContext, *ACLContext, *ServerTrackIndices, RotationPairs, TranslationPairs, ScalePairs, OutAtoms);
+			return;
+		}
+
+		::DecompressPose(DecompContext, *ACLContext, RotationPairs, TranslationPairs, ScalePairs, OutAtoms);
+	}
+
+	static FORCEINLINE_DEBUGGABLE void DecompressBone(FAnimSequenceDecompressionContext& DecompContext, ContextType* ACLContext, int32 TrackIndex, FTransform& OutAtom)
+	{
+		if (ACLContext != nullptr)
+		{
+			::DecompressBone(DecompContext, *ACLContext, TrackIndex, OutAtom);
+		}
+	}
+
+	static FORCEINLINE_DEBUGGABLE void DecompressBones(FAnimSequenceDecompressionContext& DecompContext, ContextType* ACLContext, const TArrayView<const int32> TrackIndices, TArrayView<FTransform> OutAtoms)
+	{
+		if (ACLContext != nullptr)
+		{
+			::DecompressBones(DecompContext, *ACLContext, TrackIndices, OutAtoms);
+		}
+	}
+
+	static FORCEINLINE_DEBUGGABLE void DecompressBoneAtTimes(FAnimSequenceDecompressionContext& DecompContext, ContextType* ACLContext, int32 TrackIndex, const TArrayView<const float> Times, TArrayView<FTransform> OutAtoms)
+	{
+		if (ACLContext != nullptr)
+		{
+			::DecompressBoneAtTimes(DecompContext, *ACLContext, TrackIndex, Times, OutAtoms);
+		}
+	}
+
+	static FORCEINLINE_DEBUGGABLE void DecompressBonesAtTimes(FAnimSequenceDecompressionContext& DecompContext, ContextType* ACLContext, const TArrayView<const int32> TrackIndices, const TArrayView<const float> Times, FACLPoseSamplesSoA& OutSamples)
+	{
+		if (ACLContext != nullptr)
+		{
+			::DecompressBonesAtTimes(DecompContext, *ACLContext, TrackIndices, Times, OutSamples);
+		}
+	}
+
+	static FORCEINLINE_DEBUGGABLE void ApplyAdditivePose(FAnimSequenceDecompressionContext& DecompContext, ContextType* ACLContext,
+		const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, float Weight, TArrayView<FTransform>& InOutAtoms)
+	{
+		if (ACLContext != nullptr)
+		{
+			::ApplyAdditivePose(DecompContext, *ACLContext, RotationPairs, TranslationPairs, ScalePairs, Weight, InOutAtoms);
+		}
+	}
+
+	static FORCEINLINE_DEBUGGABLE void AccumulatePose(FAnimSequenceDecompressionContext& DecompContext, ContextType* ACLContext,
+		const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, float Weight, FACLPoseAccumulator& Accumulator)
+	{
+		if (ACLContext != nullptr)
+		{
+			::AccumulatePose(DecompContext, *ACLContext, RotationPairs, TranslationPairs, ScalePairs, Weight, Accumulator);
+		}
+	}
+};
@@ -7,9 +7,19 @@
 #include "AnimationUtils.h"
 #include "PerPlatformProperties.h"
 #include "Animation/AnimCompressionTypes.h"
+#include "Async/AsyncWork.h"
+#include "HAL/IConsoleManager.h"
 #include "Interfaces/ITargetPlatform.h"
+#include "Misc/ScopeRWLock.h"
 #include "PlatformInfo.h"
 
+THIRD_PARTY_INCLUDES_START
+#include <acl/compression/track_error.h>
+#include <acl/compression/transform_error_metrics.h>
+THIRD_PARTY_INCLUDES_END
+
+#include <atomic>
+
 acl::rotation_format8 GetRotationFormat(ACLRotationFormat Format)
 {
 	switch (Format)
@@ -45,62 +55,210 @@ acl::compression_level8 GetCompressionLevel(ACLCompressionLevel Level)
 	}
 }
 
-static int32 FindAnimationTrackIndex(const FCompressibleAnimData& CompressibleAnimData, int32 BoneIndex)
+ACLArenaAllocator::~ACLArenaAllocator()
 {
-	const TArray<FTrackToSkeletonMap>& TrackToSkelMap = CompressibleAnimData.TrackToSkeletonMapTable;
-	if (BoneIndex != INDEX_NONE)
+	Reset();
+
+	for (const FBlock& Block : Blocks)
+	{
+		GMalloc->Free(Block.Data);
+	}
+}
+
+void* ACLArenaAllocator::allocate(size_t size, size_t alignment)
+{
+	if (size > MaxAllocationSize)
+	{
+		// Large allocations (e.g. the raw tracks of long takes) are freed as soon as they are released instead of
+		// accumulating in the arena until the whole compression completes
+		void* Ptr = GMalloc->Malloc(size, alignment);
+		HeapAllocations.Add(FHeapAllocation{ Ptr, size });
+		HeapAllocationsSize += size;
+		PeakSize = FMath::Max(PeakSize, PreviousBlocksSize + CurrentBlockOffset + HeapAllocationsSize);
+		return Ptr;
+	}
+
+	while (true)
 	{
-		for (int32 TrackIndex = 0; TrackIndex < TrackToSkelMap.Num(); ++TrackIndex)
+		if (CurrentBlockIndex != INDEX_NONE)
 		{
-			const FTrackToSkeletonMap& TrackToSkeleton = TrackToSkelMap[TrackIndex];
-			if (TrackToSkeleton.BoneTreeIndex == BoneIndex)
-				return TrackIndex;
+			const FBlock& Block = Blocks[CurrentBlockIndex];
+			uint8* Ptr = Align(Block.Data + CurrentBlockOffset, alignment);
+			const size_t EndOffset = size_t(Ptr - Block.Data) + size;
+
+			if (EndOffset <= Block.Size)
+			{
+				CurrentBlockOffset = EndOffset;
+				PeakSize = FMath::Max(PeakSize, PreviousBlocksSize + CurrentBlockOffset + HeapAllocationsSize);
+				return Ptr;
+			}
+
+			// Whatever remains in this block is lost until we reset
+			PreviousBlocksSize += CurrentBlockOffset;
+		}
+
+		// Move on to the next block, allocating it if we need to. Every block has the same size and can hold any
+		// allocation up to MaxAllocationSize regardless of its alignment.
+		const int32 NextBlockIndex = CurrentBlockIndex + 1;
+		if (NextBlockIndex >= Blocks.Num())
+		{
+			Blocks.Add(FBlock{ static_cast<uint8*>(GMalloc->Malloc(BlockSize, acl::iallocator::k_default_alignment)), BlockSize });
 		}
+
+		CurrentBlockIndex = NextBlockIndex;
+		CurrentBlockOffset = 0;
 	}
+}
 
-	return INDEX_NONE;
+void ACLArenaAllocator::deallocate(void* ptr, size_t size)
+{
+	if (ptr == nullptr)
+	{
+		return;
+	}
+
+	// Only a few allocations are large enough to live on the heap, a linear search is fine
+	for (int32 AllocationIndex = 0; AllocationIndex < HeapAllocations.Num(); ++AllocationIndex)
+	{
+		const FHeapAllocation& Allocation = HeapAllocations[AllocationIndex];
+		if (Allocation.Ptr == ptr)
+		{
+			GMalloc->Free(ptr);
+			HeapAllocationsSize -= Allocation.Size;
+			HeapAllocations.RemoveAtSwap(AllocationIndex, 1, false);
+			return;
+		}
+	}
+
+	// Reclaim the last allocation, temporary buffers are often released right after being used
+	if (CurrentBlockIndex != INDEX_NONE)
+	{
+		const FBlock& Block = Blocks[CurrentBlockIndex];
+		uint8* Ptr = static_cast<uint8*>(ptr);
+		if (Ptr >= Block.Data && Ptr + size == Block.Data + CurrentBlockOffset)
+		{
+			CurrentBlockOffset = size_t(Ptr - Block.Data);
+		}
+	}
+
+	// Anything else is released when we reset
 }
 
-static bool IsAdditiveBakedIntoRaw(const FCompressibleAnimData& CompressibleAnimData)
+void ACLArenaAllocator::Reset()
 {
-	if (!CompressibleAnimData.bIsValidAdditive)
+	// Allocations that were never released are freed with the arena
+	for (const FHeapAllocation& Allocation : HeapAllocations)
 	{
-		return true;	// Sequences that aren't additive don't need baking as they are already baked
+		GMalloc->Free(Allocation.Ptr);
 	}
 
-	if (CompressibleAnimData.RawAnimationData.Num() == 0)
+	HeapAllocations.Reset();
+	HeapAllocationsSize = 0;
+
+	// Retain a single block, the others are only needed by the largest clips
+	int32 NumRetainedBlocks = 0;
+	for (const FBlock& Block : Blocks)
 	{
-		return true;	// Sequences with no raw data don't need baking and we can't tell if they are baked or not so assume that they are, it doesn't matter
+		if (NumRetainedBlocks == 0 && Block.Size == BlockSize)
+		{
+			Blocks[NumRetainedBlocks++] = Block;
+		}
+		else
+		{
+			GMalloc->Free(Block.Data);
+		}
 	}
 
-	if (CompressibleAnimData.AdditiveBaseAnimationData.Num() != 0)
+	Blocks.SetNum(NumRetainedBlocks);
+
+	CurrentBlockIndex = INDEX_NONE;
+	CurrentBlockOffset = 0;
+	PreviousBlocksSize = 0;
+	PeakSize = 0;
+}
+
+static thread_local ACLArenaAllocator GArenaAllocator;
+static thread_local int32 GArenaAllocatorScopeDepth = 0;
+
+// The largest peak arena size of any compression so far
+static std::atomic<size_t> GArenaAllocatorMaxPeakSize(0);
+
+FACLScopedArenaAllocator::FACLScopedArenaAllocator()
+{
+	GArenaAllocatorScopeDepth++;
+}
+
+FACLScopedArenaAllocator::~FACLScopedArenaAllocator()
+{
+	GArenaAllocatorScopeDepth--;
+	if (GArenaAllocatorScopeDepth != 0)
 	{
-		return true;	// Sequence has raw data and additive base data, it is baked
+		return;	// An outer scope still uses the arena
 	}
 
-	return false;	// Sequence has raw data but no additive base data, it isn't baked
+	const size_t PeakSize = GArenaAllocator.GetPeakSize();
+
+	size_t MaxPeakSize = GArenaAllocatorMaxPeakSize.load(std::memory_order_relaxed);
+	while (PeakSize > MaxPeakSize && !GArenaAllocatorMaxPeakSize.compare_exchange_weak(MaxPeakSize, PeakSize, std::memory_order_relaxed))
+	{
+	}
+
+	UE_LOG(LogAnimationCompression, Verbose, TEXT("ACL arena peak size: %.1f KB (largest so far: %.1f KB)"), double(PeakSize) / 1024.0, double(FMath::Max(PeakSize, MaxPeakSize)) / 1024.0);
+
+	GArenaAllocator.Reset();
+}
+
+ACLArenaAllocator& FACLScopedArenaAllocator::Get() const
+{
+	return GArenaAllocator;
+}
+
+size_t GetArenaAllocatorMaxPeakSize()
+{
+	return GArenaAllocatorMaxPeakSize.load(std::memory_order_relaxed);
 }
 
-// Returns a bit array, a bit is true if the corresponding UE track has a skeleton bone mapped to it, false otherwise
-static TBitArray<> GetMappedUETracks(const FCompressibleAnimData& CompressibleAnimData)
+FACLBoneTrackMapping BuildBoneTrackMapping(const FCompressibleAnimData& CompressibleAnimData)
 {
 	const int32 NumBones = CompressibleAnimData.BoneData.Num();
-	const int32 NumUETracks = CompressibleAnimData.TrackToSkeletonMapTable.Num();
+	const TArray<FTrackToSkeletonMap>& TrackToSkelMap = CompressibleAnimData.TrackToSkeletonMapTable;
 
-	TBitArray<> MappedUETracks(false, NumUETracks);
+	FACLBoneTrackMapping Mapping;
+	Mapping.BoneToTrackMap.Init(INDEX_NONE, NumBones);
+	Mapping.MappedUETracks.Init(false, TrackToSkelMap.Num());
 
-	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	// A single pass over the tracks, if a bone has multiple tracks the first one is used
+	for (int32 TrackIndex = 0; TrackIndex < TrackToSkelMap.Num(); ++TrackIndex)
 	{
-		const int32 UETrackIndex = FindAnimationTrackIndex(CompressibleAnimData, BoneIndex);
-
-		if (UETrackIndex >= 0)
+		const int32 BoneIndex = TrackToSkelMap[TrackIndex].BoneTreeIndex;
+		if (BoneIndex >= 0 && BoneIndex < NumBones && Mapping.BoneToTrackMap[BoneIndex] == INDEX_NONE)
 		{
-			// This track has a bone mapped to it
-			MappedUETracks[UETrackIndex] = true;
+			Mapping.BoneToTrackMap[BoneIndex] = TrackIndex;
+			Mapping.MappedUETracks[TrackIndex] = true;
 		}
 	}
 
-	return MappedUETracks;
+	return Mapping;
+}
+
+static bool IsAdditiveBakedIntoRaw(const FCompressibleAnimData& CompressibleAnimData)
+{
+	if (!CompressibleAnimData.bIsValidAdditive)
+	{
+		return true;	// Sequences that aren't additive don't need baking as they are already baked
+	}
+
+	if (CompressibleAnimData.RawAnimationData.Num() == 0)
+	{
+		return true;	// Sequences with no raw data don't need baking and we can't tell if they are baked or not so assume that they are, it doesn't matter
+	}
+
+	if (CompressibleAnimData.AdditiveBaseAnimationData.Num() != 0)
+	{
+		return true;	// Sequence has raw data and additive base data, it is baked
+	}
+
+	return false;	// Sequence has raw data but no additive base data, it isn't baked
 }
 
 static int32 CountSetBits(const TBitArray<>& Array)
@@ -117,7 +275,71 @@ static int32 CountSetBits(const TBitArray<>& Array)
 #endif
 }
 
-acl::track_array_qvvf BuildACLTransformTrackArray(ACLAllocator& AllocatorImpl, const FCompressibleAnimData& CompressibleAnimData,
+// Returns whether or not every key is equal to the first
+template<typename KeyType>
+static bool AreKeysConstant(const TArray<KeyType>& Keys)
+{
+	for (int32 KeyIndex = 1; KeyIndex < Keys.Num(); ++KeyIndex)
+	{
+		if (!(Keys[KeyIndex] == Keys[0]))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// Returns whether or not every raw track holds a static pose
+static bool IsStaticPose(const TArray<FRawAnimSequenceTrack>& RawTracks)
+{
+	for (const FRawAnimSequenceTrack& RawTrack : RawTracks)
+	{
+		if (!AreKeysConstant(RawTrack.RotKeys) || !AreKeysConstant(RawTrack.PosKeys) || !AreKeysConstant(RawTrack.ScaleKeys))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// Copies the raw keys of a UE track into an ACL track. Raw sub-tracks with a single key are constant and
+// read with a zero stride, this keeps every sub-track loop free of branches.
+static void CopyRawTrack(const FRawAnimSequenceTrack& RawTrack, const FRawAnimTrackVector3& DefaultScale, uint32 NumSamples, acl::track_qvvf& Track)
+{
+	const FRawAnimTrackQuat* RotKeys = RawTrack.RotKeys.GetData();
+	const uint32 RotStride = RawTrack.RotKeys.Num() == 1 ? 0 : 1;
+	for (uint32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+	{
+		Track[SampleIndex].rotation = UEQuatToACL(RotKeys[SampleIndex * RotStride]);
+	}
+
+	const FRawAnimTrackVector3* PosKeys = RawTrack.PosKeys.GetData();
+	const uint32 PosStride = RawTrack.PosKeys.Num() == 1 ? 0 : 1;
+	for (uint32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+	{
+		Track[SampleIndex].translation = UEVector3ToACL(PosKeys[SampleIndex * PosStride]);
+	}
+
+	// Tracks without scale use the default scale
+	const FRawAnimTrackVector3* ScaleKeys = RawTrack.ScaleKeys.Num() == 0 ? &DefaultScale : RawTrack.ScaleKeys.GetData();
+	const uint32 ScaleStride = RawTrack.ScaleKeys.Num() > 1 ? 1 : 0;
+	for (uint32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
+	{
+		Track[SampleIndex].scale = UEVector3ToACL(ScaleKeys[SampleIndex * ScaleStride]);
+	}
+}
+
+acl::track_array_qvvf BuildACLTransformTrackArray(acl::iallocator& AllocatorImpl, const FCompressibleAnimData& CompressibleAnimData,
+	float DefaultVirtualVertexDistance, float SafeVirtualVertexDistance,
+	bool bBuildAdditiveBase, ACLPhantomTrackMode PhantomTrackMode)
+{
+	return BuildACLTransformTrackArray(AllocatorImpl, CompressibleAnimData, BuildBoneTrackMapping(CompressibleAnimData),
+		DefaultVirtualVertexDistance, SafeVirtualVertexDistance, bBuildAdditiveBase, PhantomTrackMode);
+}
+
+acl::track_array_qvvf BuildACLTransformTrackArray(acl::iallocator& AllocatorImpl, const FCompressibleAnimData& CompressibleAnimData, const FACLBoneTrackMapping& BoneTrackMapping,
 	float DefaultVirtualVertexDistance, float SafeVirtualVertexDistance,
 	bool bBuildAdditiveBase, ACLPhantomTrackMode PhantomTrackMode)
 {
@@ -142,9 +364,14 @@ acl::track_array_qvvf BuildACLTransformTrackArray(ACLAllocator& AllocatorImpl, c
 	// To avoid wasting memory, we just grab the first frame.
 
 	const TArray<FRawAnimSequenceTrack>& RawTracks = bBuildAdditiveBase ? CompressibleAnimData.AdditiveBaseAnimationData : CompressibleAnimData.RawAnimationData;
-	const uint32 NumSamples = GetNumSamples(CompressibleAnimData);
-	const bool bIsStaticPose = NumSamples <= 1 || CompressibleAnimData.SequenceLength < 0.0001f;
-	const float SampleRate = bIsStaticPose ? 30.0f : (float(NumSamples - 1) / CompressibleAnimData.SequenceLength);
+	const uint32 NumSequenceSamples = GetNumSamples(CompressibleAnimData);
+	const bool bIsStaticPose = NumSequenceSamples <= 1 || CompressibleAnimData.SequenceLength < 0.0001f;
+	const float SampleRate = bIsStaticPose ? 30.0f : (float(NumSequenceSamples - 1) / CompressibleAnimData.SequenceLength);
+
+	// An additive base that uses a single frame holds it repeated for every sample, ACL samples the base at the
+	// normalized sample time of the additive sequence and a single sample is enough.
+	const bool bIsStaticAdditiveBase = bBuildAdditiveBase && IsStaticPose(RawTracks);
+	const uint32 NumSamples = bIsStaticAdditiveBase ? FMath::Min<uint32>(NumSequenceSamples, 1) : NumSequenceSamples;
 	const int32 NumBones = CompressibleAnimData.BoneData.Num();
 	const int32 NumUETracks = CompressibleAnimData.TrackToSkeletonMapTable.Num();
 
@@ -156,7 +383,7 @@ acl::track_array_qvvf BuildACLTransformTrackArray(ACLAllocator& AllocatorImpl, c
 	ACLDefaultAdditiveBindTransform.scale = ACLDefaultScale;
 
 	// A bit array to tell which UE tracks are mapped to a skeleton bone
-	const TBitArray<> MappedUETracks = GetMappedUETracks(CompressibleAnimData);
+	const TBitArray<>& MappedUETracks = BoneTrackMapping.MappedUETracks;
 
 	// We need to make sure to allocate enough ACL tracks. It is very common to have a skeleton with a number of bones
 	// and to have anim sequences that use that skeleton that have fewer tracks. This might happen if bones are added
@@ -185,7 +412,7 @@ acl::track_array_qvvf BuildACLTransformTrackArray(ACLAllocator& AllocatorImpl, c
 		const int32 ParentBoneIndex = UEBone.GetParent();
 		Desc.parent_index = ParentBoneIndex >= 0 ? ParentBoneIndex : acl::k_invalid_track_index;
 
-		const int32 UETrackIndex = FindAnimationTrackIndex(CompressibleAnimData, BoneIndex);
+		const int32 UETrackIndex = BoneTrackMapping.BoneToTrackMap[BoneIndex];
 
 		// We output bone data in UE track order. If a track isn't present, we will use the bind pose and strip it from the
 		// compressed stream.
@@ -208,19 +435,7 @@ acl::track_array_qvvf BuildACLTransformTrackArray(ACLAllocator& AllocatorImpl, c
 		if (UETrackIndex >= 0)
 		{
 			// We have a track for this bone, use it
-			const FRawAnimSequenceTrack& RawTrack = RawTracks[UETrackIndex];
-
-			for (uint32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
-			{
-				const FRawAnimTrackQuat& RotationSample = RawTrack.RotKeys.Num() == 1 ? RawTrack.RotKeys[0] : RawTrack.RotKeys[SampleIndex];
-				Track[SampleIndex].rotation = UEQuatToACL(RotationSample);
-
-				const FRawAnimTrackVector3& TranslationSample = RawTrack.PosKeys.Num() == 1 ? RawTrack.PosKeys[0] : RawTrack.PosKeys[SampleIndex];
-				Track[SampleIndex].translation = UEVector3ToACL(TranslationSample);
-
-				const FRawAnimTrackVector3& ScaleSample = RawTrack.ScaleKeys.Num() == 0 ? UEDefaultScale : (RawTrack.ScaleKeys.Num() == 1 ? RawTrack.ScaleKeys[0] : RawTrack.ScaleKeys[SampleIndex]);
-				Track[SampleIndex].scale = UEVector3ToACL(ScaleSample);
-			}
+			CopyRawTrack(RawTracks[UETrackIndex], UEDefaultScale, NumSamples, Track);
 		}
 		else
 		{
@@ -291,19 +506,7 @@ acl::track_array_qvvf BuildACLTransformTrackArray(ACLAllocator& AllocatorImpl, c
 			}
 
 			// We have raw track data, use it
-			const FRawAnimSequenceTrack& RawTrack = RawTracks[UETrackIndex];
-
-			for (uint32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
-			{
-				const FRawAnimTrackQuat& RotationSample = RawTrack.RotKeys.Num() == 1 ? RawTrack.RotKeys[0] : RawTrack.RotKeys[SampleIndex];
-				Track[SampleIndex].rotation = UEQuatToACL(RotationSample);
-
-				const FRawAnimTrackVector3& TranslationSample = RawTrack.PosKeys.Num() == 1 ? RawTrack.PosKeys[0] : RawTrack.PosKeys[SampleIndex];
-				Track[SampleIndex].translation = UEVector3ToACL(TranslationSample);
-
-				const FRawAnimTrackVector3& ScaleSample = RawTrack.ScaleKeys.Num() == 0 ? UEDefaultScale : (RawTrack.ScaleKeys.Num() == 1 ? RawTrack.ScaleKeys[0] : RawTrack.ScaleKeys[SampleIndex]);
-				Track[SampleIndex].scale = UEVector3ToACL(ScaleSample);
-			}
+			CopyRawTrack(RawTracks[UETrackIndex], UEDefaultScale, NumSamples, Track);
 		}
 
 		// Add our extra track
@@ -317,6 +520,149 @@ acl::track_array_qvvf BuildACLTransformTrackArray(ACLAllocator& AllocatorImpl, c
 	return Tracks;
 }
 
+static TAutoConsoleVariable<int32> CVarACLCompressionErrorSampling(
+	TEXT("ACL.CompressionErrorSampling"),
+	0,
+	TEXT("Controls which compressed sequences have their ACL compression error measured in a background task. Results are reported by ACL.ListAnimSequences.\n")
+	TEXT("Sequences are selected from a hash of their name, the same sequences are measured every time.\n")
+	TEXT("0: Disabled (default)\n")
+	TEXT("1-99: The percentage of sequences to measure\n")
+	TEXT("100: Every sequence"),
+	ECVF_Default);
+
+bool ShouldMeasureCompressionError(const FString& SequenceName)
+{
+	const int32 SamplingPercentage = FMath::Clamp(CVarACLCompressionErrorSampling.GetValueOnAnyThread(), 0, 100);
+	return SamplingPercentage != 0 && int32(GetTypeHash(SequenceName) % 100) < SamplingPercentage;
+}
+
+// The compression error measured for every sequence, keyed by their full name
+static FRWLock GCompressionErrorStatsLock;
+static TMap<FString, FACLCompressionErrorStats> GCompressionErrorStats;
+
+/** Measures the compression error of a sequence off the compression thread. */
+class FACLCompressionErrorTask final : public FNonAbandonableTask
+{
+public:
+	FACLCompressionErrorTask(const FString& SequenceName_, acl::track_array_qvvf&& BoneTracks_, acl::track_array_qvvf&& BoneBaseTracks_, acl::additive_clip_format8 AdditiveFormat_, const acl::compressed_tracks& CompressedTracks)
+		: SequenceName(SequenceName_)
+		, BoneTracks(MoveTemp(BoneTracks_))
+		, BoneBaseTracks(MoveTemp(BoneBaseTracks_))
+		, AdditiveFormat(AdditiveFormat_)
+	{
+		CopyCompressedTracks(CompressedTracks);
+	}
+
+	FACLCompressionErrorTask(const FString& SequenceName_, acl::track_array_float1f&& CurveTracks_, const acl::compressed_tracks& CompressedTracks)
+		: SequenceName(SequenceName_)
+		, CurveTracks(MoveTemp(CurveTracks_))
+		, AdditiveFormat(acl::additive_clip_format8::none)
+	{
+		CopyCompressedTracks(CompressedTracks);
+	}
+
+	void DoWork()
+	{
+		FACLScopedArenaAllocator ArenaScope;
+		ACLArenaAllocator& ArenaAllocator = ArenaScope.Get();
+
+		const acl::compressed_tracks& CompressedTracks = *reinterpret_cast<const acl::compressed_tracks*>(CompressedBytes.GetData());
+
+		if (!BoneTracks.is_empty())
+		{
+			// Use debug settings in case the codec picked is the fallback
+			acl::decompression_context<UEDebugDecompressionSettings> Context;
+			Context.initialize(CompressedTracks);
+
+			acl::qvvf_transform_error_metric DefaultErrorMetric;
+			acl::additive_qvvf_transform_error_metric<acl::additive_clip_format8::relative> RelativeErrorMetric;
+			acl::additive_qvvf_transform_error_metric<acl::additive_clip_format8::additive0> Additive0ErrorMetric;
+			acl::additive_qvvf_transform_error_metric<acl::additive_clip_format8::additive1> Additive1ErrorMetric;
+
+			const acl::itransform_error_metric* ErrorMetric = &DefaultErrorMetric;
+			if (!BoneBaseTracks.is_empty())
+			{
+				switch (AdditiveFormat)
+				{
+				case acl::additive_clip_format8::relative:	ErrorMetric = &RelativeErrorMetric; break;
+				case acl::additive_clip_format8::additive0:	ErrorMetric = &Additive0ErrorMetric; break;
+				case acl::additive_clip_format8::additive1:	ErrorMetric = &Additive1ErrorMetric; break;
+				default: break;
+				}
+			}
+
+			const acl::track_error TrackError = acl::calculate_compression_error(ArenaAllocator, BoneTracks, Context, *ErrorMetric, BoneBaseTracks);
+
+			FWriteScopeLock Lock(GCompressionErrorStatsLock);
+			FACLCompressionErrorStats& Stats = GCompressionErrorStats.FindOrAdd(SequenceName);
+			Stats.BoneError = TrackError.error;
+			Stats.BoneTrackIndex = TrackError.index;
+			Stats.BoneSampleTime = TrackError.sample_time;
+		}
+		else if (!CurveTracks.is_empty())
+		{
+			acl::decompression_context<acl::debug_scalar_decompression_settings> Context;
+			Context.initialize(CompressedTracks);
+
+			const acl::track_error TrackError = acl::calculate_compression_error(ArenaAllocator, CurveTracks, Context);
+
+			FWriteScopeLock Lock(GCompressionErrorStatsLock);
+			FACLCompressionErrorStats& Stats = GCompressionErrorStats.FindOrAdd(SequenceName);
+			Stats.CurveError = TrackError.error;
+			Stats.CurveIndex = TrackError.index;
+			Stats.CurveSampleTime = TrackError.sample_time;
+		}
+	}
+
+	FORCEINLINE TStatId GetStatId() const
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FACLCompressionErrorTask, STATGROUP_ThreadPoolAsyncTasks);
+	}
+
+private:
+	void CopyCompressedTracks(const acl::compressed_tracks& CompressedTracks)
+	{
+		const uint32 CompressedSize = CompressedTracks.get_size();
+		CompressedBytes.AddUninitialized(CompressedSize);
+		FMemory::Memcpy(CompressedBytes.GetData(), &CompressedTracks, CompressedSize);
+	}
+
+	FString SequenceName;
+
+	acl::track_array_qvvf BoneTracks;
+	acl::track_array_qvvf BoneBaseTracks;
+	acl::track_array_float1f CurveTracks;
+	acl::additive_clip_format8 AdditiveFormat;
+
+	// Compressed tracks must be 16 bytes aligned
+	TArray<uint8, TAlignedHeapAllocator<16>> CompressedBytes;
+};
+
+void MeasureBoneCompressionErrorAsync(const FString& SequenceName, acl::track_array_qvvf&& RawTracks, acl::track_array_qvvf&& BaseTracks,
+	acl::additive_clip_format8 AdditiveFormat, const acl::compressed_tracks& CompressedTracks)
+{
+	(new FAutoDeleteAsyncTask<FACLCompressionErrorTask>(SequenceName, MoveTemp(RawTracks), MoveTemp(BaseTracks), AdditiveFormat, CompressedTracks))->StartBackgroundTask();
+}
+
+void MeasureCurveCompressionErrorAsync(const FString& SequenceName, acl::track_array_float1f&& RawTracks, const acl::compressed_tracks& CompressedTracks)
+{
+	(new FAutoDeleteAsyncTask<FACLCompressionErrorTask>(SequenceName, MoveTemp(RawTracks), CompressedTracks))->StartBackgroundTask();
+}
+
+bool GetCompressionErrorStats(const FString& SequenceName, FACLCompressionErrorStats& OutStats)
+{
+	FReadScopeLock Lock(GCompressionErrorStatsLock);
+
+	const FACLCompressionErrorStats* Stats = GCompressionErrorStats.Find(SequenceName);
+	if (Stats == nullptr)
+	{
+		return false;
+	}
+
+	OutStats = *Stats;
+	return true;
+}
+
 uint32 GetNumSamples(const FCompressibleAnimData& CompressibleAnimData)
 {
 #if ENGINE_MAJOR_VERSION >= 5
@@ -1,6 +1,7 @@
 // Copyright 2018 Nicholas Frechette. All Rights Reserved.
 
 #include "CoreMinimal.h"
+#include "AnimationCompression.h"
 #include "IACLPluginModule.h"
 #include "Misc/CoreDelegates.h"
 #include "Modules/ModuleManager.h"
@@ -13,7 +14,6 @@
 #include "AnimationCompressionLibraryDatabase.h"
 #include "AnimBoneCompressionCodec_ACLDatabase.h"
 
-#include "AnimationCompression.h"
 #include "Animation/AnimBoneCompressionCodec.h"
 #include "Animation/AnimBoneCompressionSettings.h"
 #include "Animation/AnimCurveCompressionCodec.h"
@@ -293,6 +293,14 @@ void FACLPlugin::ListAnimSequences(const TArray<FString>& Args)
 		{
 			UE_LOG(LogAnimationCompression, Log, TEXT("    has a bone error of %.4f cm"), AnimSeq->CompressedData.CompressedDataStructure->BoneCompressionErrorStats.MaxError);
 		}
+
+		// Only present if the sequence was compressed since the editor started, see ACL.CompressionErrorSampling
+		FACLCompressionErrorStats ErrorStats;
+		const bool bHasErrorStats = GetCompressionErrorStats(AnimSeq->GetFullName(), ErrorStats);
+		if (bHasErrorStats && ErrorStats.BoneError >= 0.0f)
+		{
+			UE_LOG(LogAnimationCompression, Log, TEXT("    has an ACL bone error of %.4f cm (track %u @ %.3f)"), ErrorStats.BoneError, ErrorStats.BoneTrackIndex, ErrorStats.BoneSampleTime);
+		}
 #endif
 
 		UE_LOG(LogAnimationCompression, Log, TEXT("    uses curve codec %s"), *AnimSeq->CompressedData.CurveCompressionCodec->GetPathName());
@@ -300,6 +308,13 @@ void FACLPlugin::ListAnimSequences(const TArray<FString>& Args)
 		const SIZE_T CurveDataSize = GetCompressedCurveSize(AnimSeq->CompressedData);
 		UE_LOG(LogAnimationCompression, Log, TEXT("    has %.2f KB of curve data"), BytesToKB(CurveDataSize));
 
+#if WITH_EDITORONLY_DATA
+		if (bHasErrorStats && ErrorStats.CurveError >= 0.0f)
+		{
+			UE_LOG(LogAnimationCompression, Log, TEXT("    has an ACL curve error of %.4f (curve %u @ %.3f)"), ErrorStats.CurveError, ErrorStats.CurveIndex, ErrorStats.CurveSampleTime);
+		}
+#endif
+
 		BoneDataTotalSize += BoneDataSize;
 		CurveDataTotalSize += CurveDataSize;
 	}
@@ -307,6 +322,11 @@ void FACLPlugin::ListAnimSequences(const TArray<FString>& Args)
 	UE_LOG(LogAnimationCompression, Log, TEXT("Total bone data size: %.2f MB"), BytesToMB(BoneDataTotalSize));
 	UE_LOG(LogAnimationCompression, Log, TEXT("Total curve data size: %.2f MB"), BytesToMB(CurveDataTotalSize));
 
+#if WITH_EDITORONLY_DATA
+	// Only present if a sequence was compressed since the editor started
+	UE_LOG(LogAnimationCompression, Log, TEXT("Largest compression arena peak size: %.2f MB"), BytesToMB(GetArenaAllocatorMaxPeakSize()));
+#endif
+
 	LogAnimationCompression.SetVerbosity(OldVerbosity);
 }
 
@@ -344,6 +364,28 @@ void FACLPlugin::SetDatabaseVisualFidelity(const TArray<FString>& Args)
 }
 #endif
 
+/** Returns the instruction set that decompression was compiled with. */
+static const TCHAR* GetDecompressionInstructionSetName()
+{
+#if defined(RTM_AVX2_INTRINSICS)
+	return TEXT("AVX2");
+#elif defined(RTM_AVX_INTRINSICS)
+	return TEXT("AVX");
+#elif defined(RTM_SSE4_INTRINSICS)
+	return TEXT("SSE4");
+#elif defined(RTM_SSE3_INTRINSICS)
+	return TEXT("SSE3");
+#elif defined(RTM_SSE2_INTRINSICS)
+	return TEXT("SSE2");
+#elif defined(RTM_NEON64_INTRINSICS)
+	return TEXT("NEON64");
+#elif defined(RTM_NEON_INTRINSICS)
+	return TEXT("NEON");
+#else
+	return TEXT("Scalar");
+#endif
+}
+
 #if WITH_EDITORONLY_DATA
 void FACLPlugin::OnPostEngineInit()
 {
@@ -353,6 +395,15 @@ void FACLPlugin::OnPostEngineInit()
 
 void FACLPlugin::StartupModule()
 {
+#if defined(ACL_USE_POPCOUNT)
+	const TCHAR* PopcountStatus = TEXT("enabled");
+#else
+	const TCHAR* PopcountStatus = TEXT("disabled");
+#endif
+
+	// The instruction set is selected at compile time for the whole target, log it to help diagnose performance differences between builds
+	UE_LOG(LogAnimationCompression, Log, TEXT("ACL decompression uses %s with popcount %s on %s"), GetDecompressionInstructionSetName(), PopcountStatus, *FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+
 #if WITH_ACL_CONSOLE_COMMANDS
 	if (!IsRunningCommandlet())
 	{
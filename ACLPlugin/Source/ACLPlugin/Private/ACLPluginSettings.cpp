@@ -0,0 +1,12 @@
+// Copyright 2026 Nicholas Frechette. All Rights Reserved.
+
+#include "ACLPluginSettings.h"
+
+#if (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1)
+#include UE_INLINE_GENERATED_CPP_BY_NAME(ACLPluginSettings)
+#endif
+
+UACLPluginSettings::UACLPluginSettings(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+}
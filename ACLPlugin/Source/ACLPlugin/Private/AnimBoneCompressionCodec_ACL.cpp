@@ -80,27 +80,40 @@ void UAnimBoneCompressionCodec_ACL::PopulateDDCKey(FArchive& Ar)
 }
 #endif // WITH_EDITORONLY_DATA
 
+using FACLDefaultDecompression = TACLCodecDecompression<UEDefaultDecompressionSettings>;
+
 void UAnimBoneCompressionCodec_ACL::DecompressPose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, TArrayView<FTransform>& OutAtoms) const
 {
-	const FACLCompressedAnimData& AnimData = static_cast<const FACLCompressedAnimData&>(DecompContext.CompressedAnimData);
-	const acl::compressed_tracks* CompressedClipData = AnimData.GetCompressedTracks();
-	check(CompressedClipData != nullptr && CompressedClipData->is_valid(false).empty());
+	FACLDefaultDecompression::DecompressPose(DecompContext, FACLDefaultDecompression::GetPooledContext(DecompContext), FACLDefaultDecompression::GetServerTrackIndices(DecompContext), RotationPairs, TranslationPairs, ScalePairs, OutAtoms);
+}
 
-	acl::decompression_context<UEDefaultDecompressionSettings> ACLContext;
-	ACLContext.initialize(*CompressedClipData);
+void UAnimBoneCompressionCodec_ACL::DecompressBone(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, FTransform& OutAtom) const
+{
+	FACLDefaultDecompression::DecompressBone(DecompContext, FACLDefaultDecompression::GetPooledContext(DecompContext), TrackIndex, OutAtom);
+}
 
-	::DecompressPose(DecompContext, ACLContext, RotationPairs, TranslationPairs, ScalePairs, OutAtoms);
+void UAnimBoneCompressionCodec_ACL::DecompressBones(FAnimSequenceDecompressionContext& DecompContext, const TArrayView<const int32> TrackIndices, TArrayView<FTransform> OutAtoms) const
+{
+	FACLDefaultDecompression::DecompressBones(DecompContext, FACLDefaultDecompression::GetPooledContext(DecompContext), TrackIndices, OutAtoms);
 }
 
-void UAnimBoneCompressionCodec_ACL::DecompressBone(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, FTransform& OutAtom) const
+void UAnimBoneCompressionCodec_ACL::DecompressBoneAtTimes(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, const TArrayView<const float> Times, TArrayView<FTransform> OutAtoms) const
 {
-	const FACLCompressedAnimData& AnimData = static_cast<const FACLCompressedAnimData&>(DecompContext.CompressedAnimData);
-	const acl::compressed_tracks* CompressedClipData = AnimData.GetCompressedTracks();
-	check(CompressedClipData != nullptr && CompressedClipData->is_valid(false).empty());
+	FACLDefaultDecompression::DecompressBoneAtTimes(DecompContext, FACLDefaultDecompression::GetPooledContext(DecompContext), TrackIndex, Times, OutAtoms);
+}
 
-	acl::decompression_context<UEDefaultDecompressionSettings> ACLContext;
-	ACLContext.initialize(*CompressedClipData);
+void UAnimBoneCompressionCodec_ACL::DecompressBonesAtTimes(FAnimSequenceDecompressionContext& DecompContext, const TArrayView<const int32> TrackIndices, const TArrayView<const float> Times, FACLPoseSamplesSoA& OutSamples) const
+{
+	FACLDefaultDecompression::DecompressBonesAtTimes(DecompContext, FACLDefaultDecompression::GetPooledContext(DecompContext), TrackIndices, Times, OutSamples);
+}
 
-	::DecompressBone(DecompContext, ACLContext, TrackIndex, OutAtom);
+void UAnimBoneCompressionCodec_ACL::ApplyAdditivePose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, float Weight, TArrayView<FTransform>& InOutAtoms) const
+{
+	FACLDefaultDecompression::ApplyAdditivePose(DecompContext, FACLDefaultDecompression::GetPooledContext(DecompContext), RotationPairs, TranslationPairs, ScalePairs, Weight, InOutAtoms);
+}
+
+void UAnimBoneCompressionCodec_ACL::AccumulatePose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, float Weight, FACLPoseAccumulator& Accumulator) const
+{
+	FACLDefaultDecompression::AccumulatePose(DecompContext, FACLDefaultDecompression::GetPooledContext(DecompContext), RotationPairs, TranslationPairs, ScalePairs, Weight, Accumulator);
 }
 
@@ -1,6 +1,7 @@
 // Copyright 2018 Nicholas Frechette. All Rights Reserved.
 
 #include "AnimBoneCompressionCodec_ACLBase.h"
+#include "ACLPluginSettings.h"
 #include "Animation/Skeleton.h"
 #include "Serialization/MemoryWriter.h"
 #include "Serialization/MemoryReader.h"
@@ -12,7 +13,10 @@
 #if WITH_EDITORONLY_DATA
 #include "AnimBoneCompressionCodec_ACLSafe.h"
 #include "Animation/AnimationSettings.h"
+#include "Async/ParallelFor.h"
+#include "DerivedDataCacheInterface.h"
 #include "Engine/SkeletalMesh.h"
+#include "Misc/ScopeRWLock.h"
 #include "Rendering/SkeletalMeshModel.h"
 #include "Runtime/Launch/Resources/Version.h"
 
@@ -22,7 +26,6 @@ THIRD_PARTY_INCLUDES_START
 #include <acl/compression/compress.h>
 #include <acl/compression/pre_process.h>
 #include <acl/compression/transform_error_metrics.h>
-#include <acl/compression/track_error.h>
 #include <acl/core/bitset.h>
 #include <acl/core/compressed_tracks_version.h>
 #include <acl/decompression/decompress.h>
@@ -31,6 +34,46 @@ THIRD_PARTY_INCLUDES_END
 
 #include <acl/core/compressed_tracks.h>
 
+#include "ACLDecompressionImpl.h"
+
+void FACLCompressedAnimData::Bind(const TArrayView<uint8> BulkData)
+{
+	CompressedByteStream = BulkData;
+
+	// Validate our data once, decompression skips the safety checks and outputs a T-pose if it is invalid
+	const acl::compressed_tracks* CompressedClipData = acl::make_compressed_tracks(BulkData.GetData());
+	bIsDataValid = CompressedClipData != nullptr && CompressedClipData->is_valid(false).empty();
+
+	if (!bIsDataValid && BulkData.Num() != 0)
+	{
+		UE_LOG(LogAnimationCompression, Error, TEXT("ACL compressed data is invalid or corrupted, decompression will yield a T-pose"));
+	}
+
+	// The dedicated server track subset, if present, follows our compressed tracks: the number of tracks followed by their indices
+	bHasServerTrackSubset = false;
+	ServerTrackIndices = TArrayView<const uint16>();
+
+	if (bIsDataValid)
+	{
+		const int32 SubsetOffset = Align(int32(CompressedClipData->get_size()), alignof(uint32));
+		if (BulkData.Num() >= SubsetOffset + int32(sizeof(uint32)))
+		{
+			const uint32 NumServerTracks = *reinterpret_cast<const uint32*>(BulkData.GetData() + SubsetOffset);
+			const uint16* ServerTrackIndicesData = reinterpret_cast<const uint16*>(BulkData.GetData() + SubsetOffset + sizeof(uint32));
+
+			if (BulkData.Num() == SubsetOffset + int32(sizeof(uint32) + NumServerTracks * sizeof(uint16)))
+			{
+				bHasServerTrackSubset = true;
+				ServerTrackIndices = TArrayView<const uint16>(ServerTrackIndicesData, int32(NumServerTracks));
+			}
+			else
+			{
+				UE_LOG(LogAnimationCompression, Warning, TEXT("ACL dedicated server track subset is corrupted, the whole pose will be decompressed"));
+			}
+		}
+	}
+}
+
 bool FACLCompressedAnimData::IsValid() const
 {
 	if (CompressedByteStream.Num() == 0)
@@ -60,26 +103,18 @@ UAnimBoneCompressionCodec_ACLBase::UAnimBoneCompressionCodec_ACLBase(const FObje
 }
 
 #if WITH_EDITORONLY_DATA
-static void AppendMaxVertexDistances(USkeletalMesh* OptimizationTarget, TMap<FName, float>& BoneMaxVertexDistanceMap)
-{
-#if (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 27) || ENGINE_MAJOR_VERSION >= 5
-	USkeleton* Skeleton = OptimizationTarget != nullptr ? OptimizationTarget->GetSkeleton() : nullptr;
-#else
-	USkeleton* Skeleton = OptimizationTarget != nullptr ? OptimizationTarget->Skeleton : nullptr;
-#endif
+using FBoneMaxVertexDistancesPtr = TSharedPtr<const TMap<FName, float>, ESPMode::ThreadSafe>;
 
-	if (Skeleton == nullptr)
-	{
-		return; // No data to work with
-	}
-
-	const FSkeletalMeshModel* MeshModel = OptimizationTarget->GetImportedModel();
-	if (MeshModel == nullptr || MeshModel->LODModels.Num() == 0)
-	{
-		return;	// No data to work with
-	}
+/*
+ * The most distant vertex of every bone, per skeletal mesh model and skeleton reference pose.
+ * Every sequence that uses a mesh as an optimization target shares the same table. Tables are computed once,
+ * stored in the DDC, and remain in memory for the lifetime of the editor or cook.
+ */
+static FRWLock GBoneMaxVertexDistancesLock;
+static TMap<FString, FBoneMaxVertexDistancesPtr> GBoneMaxVertexDistances;
 
-	const FReferenceSkeleton& RefSkeleton = Skeleton->GetReferenceSkeleton();
+static FBoneMaxVertexDistancesPtr ComputeBoneMaxVertexDistances(const FReferenceSkeleton& RefSkeleton, const FSkeletalMeshLODModel& LODModel)
+{
 	const TArray<FTransform>& RefSkeletonPose = RefSkeleton.GetRefBonePose();
 	const uint32 NumBones = RefSkeletonPose.Num();
 
@@ -99,15 +134,20 @@ static void AppendMaxVertexDistances(USkeletalMesh* OptimizationTarget, TMap<FNa
 	}
 
 	// Iterate over every vertex and track which one is the most distant for every bone
-	TArray<float> MostDistantVertexDistancePerBone;
-	MostDistantVertexDistancePerBone.AddZeroed(NumBones);
+	// Sections are processed in parallel, each with its own table that we merge afterwards
+	const int32 NumSections = LODModel.Sections.Num();
 
-	const uint32 NumSections = MeshModel->LODModels[0].Sections.Num();
-	for (uint32 SectionIndex = 0; SectionIndex < NumSections; ++SectionIndex)
+	TArray<TArray<float>> MostDistantVertexDistancePerSection;
+	MostDistantVertexDistancePerSection.SetNum(NumSections);
+
+	ParallelFor(NumSections, [&](int32 SectionIndex)
 	{
-		const FSkelMeshSection& Section = MeshModel->LODModels[0].Sections[SectionIndex];
+		const FSkelMeshSection& Section = LODModel.Sections[SectionIndex];
 		const uint32 NumVertices = Section.SoftVertices.Num();
 
+		TArray<float>& MostDistantVertexDistancePerBone = MostDistantVertexDistancePerSection[SectionIndex];
+		MostDistantVertexDistancePerBone.AddZeroed(NumBones);
+
 		for (uint32 VertexIndex = 0; VertexIndex < NumVertices; ++VertexIndex)
 		{
 			const FSoftSkinVertex& VertexInfo = Section.SoftVertices[VertexIndex];
@@ -130,18 +170,147 @@ static void AppendMaxVertexDistances(USkeletalMesh* OptimizationTarget, TMap<FNa
 				}
 			}
 		}
-	}
+	});
 
 	// Store the results in a map by bone name since the optimizing target might use a different
 	// skeleton mapping.
+	TSharedPtr<TMap<FName, float>, ESPMode::ThreadSafe> BoneMaxVertexDistanceMap = MakeShared<TMap<FName, float>, ESPMode::ThreadSafe>();
+	BoneMaxVertexDistanceMap->Reserve(NumBones);
+
 	for (uint32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
 	{
-		const FName BoneName = RefSkeleton.GetBoneName(BoneIndex);
-		const float MostDistantVertexDistance = MostDistantVertexDistancePerBone[BoneIndex];
+		float MostDistantVertexDistance = 0.0f;
+		for (const TArray<float>& MostDistantVertexDistancePerBone : MostDistantVertexDistancePerSection)
+		{
+			MostDistantVertexDistance = FMath::Max(MostDistantVertexDistance, MostDistantVertexDistancePerBone[BoneIndex]);
+		}
 
-		float& BoneMaxVertexDistance = BoneMaxVertexDistanceMap.FindOrAdd(BoneName, 0.0f);
+		float& BoneMaxVertexDistance = BoneMaxVertexDistanceMap->FindOrAdd(RefSkeleton.GetBoneName(BoneIndex), 0.0f);
 		BoneMaxVertexDistance = FMath::Max(BoneMaxVertexDistance, MostDistantVertexDistance);
 	}
+
+	return BoneMaxVertexDistanceMap;
+}
+
+static uint32 HashRefBonePose(const TArray<FTransform>& RefBonePose)
+{
+	// Only hash the transform components, the padding of vectorized transforms isn't stable between sessions and platforms
+	uint32 Hash = 0;
+	for (const FTransform& Transform : RefBonePose)
+	{
+		const FQuat Rotation = Transform.GetRotation();
+		const FVector Translation = Transform.GetTranslation();
+		const FVector Scale3D = Transform.GetScale3D();
+
+		const double Components[] =
+		{
+			Rotation.X, Rotation.Y, Rotation.Z, Rotation.W,
+			Translation.X, Translation.Y, Translation.Z,
+			Scale3D.X, Scale3D.Y, Scale3D.Z,
+		};
+
+		Hash = FCrc::MemCrc32(Components, sizeof(Components), Hash);
+	}
+
+	return Hash;
+}
+
+static FBoneMaxVertexDistancesPtr GetBoneMaxVertexDistances(USkeletalMesh* OptimizationTarget)
+{
+#if (ENGINE_MAJOR_VERSION == 4 && ENGINE_MINOR_VERSION >= 27) || ENGINE_MAJOR_VERSION >= 5
+	USkeleton* Skeleton = OptimizationTarget != nullptr ? OptimizationTarget->GetSkeleton() : nullptr;
+#else
+	USkeleton* Skeleton = OptimizationTarget != nullptr ? OptimizationTarget->Skeleton : nullptr;
+#endif
+
+	if (Skeleton == nullptr)
+	{
+		return nullptr; // No data to work with
+	}
+
+	const FSkeletalMeshModel* MeshModel = OptimizationTarget->GetImportedModel();
+	if (MeshModel == nullptr || MeshModel->LODModels.Num() == 0)
+	{
+		return nullptr;	// No data to work with
+	}
+
+	// The distances depend on the mesh geometry and on the skeleton reference pose
+	const FReferenceSkeleton& RefSkeleton = Skeleton->GetReferenceSkeleton();
+	const TArray<FTransform>& RefSkeletonPose = RefSkeleton.GetRefBonePose();
+	const uint32 RefPoseHash = HashRefBonePose(RefSkeletonPose);
+	const FString KeySuffix = FString::Printf(TEXT("%s_%s_%08X"), *MeshModel->SkeletalMeshModelGUID.ToString(), *Skeleton->GetGuid().ToString(), RefPoseHash);
+
+	{
+		FReadScopeLock ReadLock(GBoneMaxVertexDistancesLock);
+		if (const FBoneMaxVertexDistancesPtr* CachedDistances = GBoneMaxVertexDistances.Find(KeySuffix))
+		{
+			return *CachedDistances;
+		}
+	}
+
+	// Bump the version when the computation changes
+	const FString DDCKey = FDerivedDataCacheInterface::BuildCacheKey(TEXT("ACLMAXVERTEXDIST"), TEXT("1"), *KeySuffix);
+
+	FBoneMaxVertexDistancesPtr BoneMaxVertexDistances;
+
+	TArray<uint8> DDCData;
+#if ENGINE_MAJOR_VERSION >= 5 || ENGINE_MINOR_VERSION >= 26
+	const bool bFoundInDDC = GetDerivedDataCacheRef().GetSynchronous(*DDCKey, DDCData, OptimizationTarget->GetPathName());
+#else
+	const bool bFoundInDDC = GetDerivedDataCacheRef().GetSynchronous(*DDCKey, DDCData);
+#endif
+
+	if (bFoundInDDC)
+	{
+		TSharedPtr<TMap<FName, float>, ESPMode::ThreadSafe> LoadedDistances = MakeShared<TMap<FName, float>, ESPMode::ThreadSafe>();
+
+		FMemoryReader Reader(DDCData);
+		Reader << *LoadedDistances;
+
+		BoneMaxVertexDistances = LoadedDistances;
+	}
+	else
+	{
+		BoneMaxVertexDistances = ComputeBoneMaxVertexDistances(RefSkeleton, MeshModel->LODModels[0]);
+
+		TMap<FName, float> DistancesToSave = *BoneMaxVertexDistances;
+
+		FMemoryWriter Writer(DDCData);
+		Writer << DistancesToSave;
+
+#if ENGINE_MAJOR_VERSION >= 5 || ENGINE_MINOR_VERSION >= 26
+		GetDerivedDataCacheRef().Put(*DDCKey, DDCData, OptimizationTarget->GetPathName());
+#else
+		GetDerivedDataCacheRef().Put(*DDCKey, DDCData);
+#endif
+	}
+
+	{
+		// If another thread raced us, keep theirs, both are equivalent
+		FWriteScopeLock WriteLock(GBoneMaxVertexDistancesLock);
+		if (const FBoneMaxVertexDistancesPtr* CachedDistances = GBoneMaxVertexDistances.Find(KeySuffix))
+		{
+			return *CachedDistances;
+		}
+
+		GBoneMaxVertexDistances.Add(KeySuffix, BoneMaxVertexDistances);
+		return BoneMaxVertexDistances;
+	}
+}
+
+static void AppendMaxVertexDistances(USkeletalMesh* OptimizationTarget, TMap<FName, float>& BoneMaxVertexDistanceMap)
+{
+	const FBoneMaxVertexDistancesPtr BoneMaxVertexDistances = GetBoneMaxVertexDistances(OptimizationTarget);
+	if (!BoneMaxVertexDistances.IsValid())
+	{
+		return;	// No data to work with
+	}
+
+	for (const TPair<FName, float>& Pair : *BoneMaxVertexDistances)
+	{
+		float& BoneMaxVertexDistance = BoneMaxVertexDistanceMap.FindOrAdd(Pair.Key, 0.0f);
+		BoneMaxVertexDistance = FMath::Max(BoneMaxVertexDistance, Pair.Value);
+	}
 }
 
 static void PopulateShellDistanceFromOptimizationTargets(const FCompressibleAnimData& CompressibleAnimData, const TArray<USkeletalMesh*>& OptimizationTargets, acl::track_array_qvvf& ACLTracks)
@@ -190,6 +359,59 @@ static void PopulateShellDistanceFromOptimizationTargets(const FCompressibleAnim
 	}
 }
 
+/*
+ * Appends the tracks required by dedicated servers after our compressed tracks (see UACLPluginSettings::ServerBoneNames).
+ * Requested bones pull in their parents and the root. The subset holds UE track indices which match the ACL output track indices.
+ */
+static void AppendServerTrackSubset(const FCompressibleAnimData& CompressibleAnimData, const FACLBoneTrackMapping& BoneTrackMapping, TArray<uint8>& CompressedByteStream)
+{
+	const TArray<FName>& ServerBoneNames = GetDefault<UACLPluginSettings>()->ServerBoneNames;
+	if (ServerBoneNames.Num() == 0)
+	{
+		return;	// No subset, dedicated servers decompress the whole pose
+	}
+
+	const int32 NumBones = CompressibleAnimData.BoneData.Num();
+
+	TBitArray<> RequiredBones(false, NumBones);
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		if (BoneIndex != 0 && !ServerBoneNames.Contains(CompressibleAnimData.BoneData[BoneIndex].Name))
+		{
+			continue;	// Not required
+		}
+
+		// Component space transforms depend on every parent up to the root
+		for (int32 ChainBoneIndex = BoneIndex; ChainBoneIndex != INDEX_NONE && !RequiredBones[ChainBoneIndex]; ChainBoneIndex = CompressibleAnimData.BoneData[ChainBoneIndex].GetParent())
+		{
+			RequiredBones[ChainBoneIndex] = true;
+		}
+	}
+
+	TArray<uint16> ServerTrackIndices;
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		if (RequiredBones[BoneIndex])
+		{
+			const int32 UETrackIndex = BoneTrackMapping.BoneToTrackMap[BoneIndex];
+			if (UETrackIndex != INDEX_NONE)
+			{
+				ServerTrackIndices.Add(uint16(UETrackIndex));
+			}
+		}
+	}
+
+	// Sorted indices keep our reads in the compressed data ordered
+	ServerTrackIndices.Sort();
+
+	const uint32 NumServerTracks = ServerTrackIndices.Num();
+	const int32 SubsetOffset = Align(CompressedByteStream.Num(), alignof(uint32));
+
+	CompressedByteStream.AddZeroed(SubsetOffset - CompressedByteStream.Num() + sizeof(uint32) + NumServerTracks * sizeof(uint16));
+	FMemory::Memcpy(CompressedByteStream.GetData() + SubsetOffset, &NumServerTracks, sizeof(uint32));
+	FMemory::Memcpy(CompressedByteStream.GetData() + SubsetOffset + sizeof(uint32), ServerTrackIndices.GetData(), NumServerTracks * sizeof(uint16));
+}
+
 #if ACL_WITH_BIND_POSE_STRIPPING
 static void StripBindPose(const FCompressibleAnimData& CompressibleAnimData, acl::track_array_qvvf& ACLTracks)
 {
@@ -227,11 +449,22 @@ static void StripBindPose(const FCompressibleAnimData& CompressibleAnimData, acl
 
 bool UAnimBoneCompressionCodec_ACLBase::Compress(const FCompressibleAnimData& CompressibleAnimData, FCompressibleAnimDataResult& OutResult)
 {
-	acl::track_array_qvvf ACLTracks = BuildACLTransformTrackArray(ACLAllocatorImpl, CompressibleAnimData, DefaultVirtualVertexDistance, SafeVirtualVertexDistance, false, PhantomTrackMode);
+	// Every temporary allocation lives in the arena of this thread, it is released at once when we are done
+	FACLScopedArenaAllocator ArenaScope;
+	ACLArenaAllocator& ArenaAllocator = ArenaScope.Get();
+
+	// The bone to track mapping is shared by every step below
+	const FACLBoneTrackMapping BoneTrackMapping = BuildBoneTrackMapping(CompressibleAnimData);
+
+	// When we measure the compression error, the raw tracks are handed over to a background task and must outlive the arena
+	const bool bMeasureCompressionError = ShouldMeasureCompressionError(CompressibleAnimData.FullName);
+	acl::iallocator& TrackAllocator = bMeasureCompressionError ? static_cast<acl::iallocator&>(ACLAllocatorImpl) : static_cast<acl::iallocator&>(ArenaAllocator);
+
+	acl::track_array_qvvf ACLTracks = BuildACLTransformTrackArray(TrackAllocator, CompressibleAnimData, BoneTrackMapping, DefaultVirtualVertexDistance, SafeVirtualVertexDistance, false, PhantomTrackMode);
 
 	acl::track_array_qvvf ACLBaseTracks;
 	if (CompressibleAnimData.bIsValidAdditive)
-		ACLBaseTracks = BuildACLTransformTrackArray(ACLAllocatorImpl, CompressibleAnimData, DefaultVirtualVertexDistance, SafeVirtualVertexDistance, true, PhantomTrackMode);
+		ACLBaseTracks = BuildACLTransformTrackArray(TrackAllocator, CompressibleAnimData, BoneTrackMapping, DefaultVirtualVertexDistance, SafeVirtualVertexDistance, true, PhantomTrackMode);
 
 	UE_LOG(LogAnimationCompression, Verbose, TEXT("ACL Animation raw size: %u bytes [%s]"), ACLTracks.get_raw_size(), *CompressibleAnimData.FullName);
 
@@ -308,12 +541,12 @@ bool UAnimBoneCompressionCodec_ACLBase::Compress(const FCompressibleAnimData& Co
 			PreProcessSettings.additive_format = AdditiveFormat;
 		}
 
-		acl::pre_process_track_list(ACLAllocatorImpl, PreProcessSettings, ACLTracks);
+		acl::pre_process_track_list(TrackAllocator, PreProcessSettings, ACLTracks);
 	}
 
 	acl::output_stats Stats;
 	acl::compressed_tracks* CompressedTracks = nullptr;
-	const acl::error_result CompressionResult = acl::compress_track_list(ACLAllocatorImpl, ACLTracks, Settings, ACLBaseTracks, AdditiveFormat, CompressedTracks, Stats);
+	const acl::error_result CompressionResult = acl::compress_track_list(ArenaAllocator, ACLTracks, Settings, ACLBaseTracks, AdditiveFormat, CompressedTracks, Stats);
 
 	if (!CompressionResult.empty() || CompressedTracks == nullptr)
 	{
@@ -329,6 +562,8 @@ bool UAnimBoneCompressionCodec_ACLBase::Compress(const FCompressibleAnimData& Co
 	OutResult.CompressedByteStream.AddUninitialized(CompressedClipDataSize);
 	FMemory::Memcpy(OutResult.CompressedByteStream.GetData(), CompressedTracks, CompressedClipDataSize);
 
+	AppendServerTrackSubset(CompressibleAnimData, BoneTrackMapping, OutResult.CompressedByteStream);
+
 	OutResult.Codec = this;
 
 	OutResult.AnimData = AllocateAnimData();
@@ -339,20 +574,14 @@ bool UAnimBoneCompressionCodec_ACLBase::Compress(const FCompressibleAnimData& Co
 	OutResult.AnimData->CompressedNumberOfFrames = GetNumSamples(CompressibleAnimData);
 #endif
 
-#if !NO_LOGGING
-	{
-		// Use debug settings in case codec picked is the fallback
-		acl::decompression_context<UEDebugDecompressionSettings> Context;
-		Context.initialize(*CompressedTracks);
+	UE_LOG(LogAnimationCompression, Verbose, TEXT("ACL Animation compressed size: %u bytes [%s]"), CompressedClipDataSize, *CompressibleAnimData.FullName);
 
-		const acl::track_error TrackError = acl::calculate_compression_error(ACLAllocatorImpl, ACLTracks, Context, *Settings.error_metric, ACLBaseTracks);
-
-		UE_LOG(LogAnimationCompression, Verbose, TEXT("ACL Animation compressed size: %u bytes [%s]"), CompressedClipDataSize, *CompressibleAnimData.FullName);
-		UE_LOG(LogAnimationCompression, Verbose, TEXT("ACL Animation error: %.4f cm (bone %u @ %.3f) [%s]"), TrackError.error, TrackError.index, TrackError.sample_time, *CompressibleAnimData.FullName);
+	if (bMeasureCompressionError)
+	{
+		MeasureBoneCompressionErrorAsync(CompressibleAnimData.FullName, MoveTemp(ACLTracks), MoveTemp(ACLBaseTracks), AdditiveFormat, *CompressedTracks);
 	}
-#endif
 
-	ACLAllocatorImpl.deallocate(CompressedTracks, CompressedClipDataSize);
+	ArenaAllocator.deallocate(CompressedTracks, CompressedClipDataSize);
 
 	// Allow codecs to override final anim data and result
 	PostCompression(CompressibleAnimData, OutResult);
@@ -377,7 +606,7 @@ void UAnimBoneCompressionCodec_ACLBase::PopulateDDCKey(FArchive& Ar)
 	Super::PopulateDDCKey(Ar);
 #endif
 
-	uint32 ForceRebuildVersion = 18;
+	uint32 ForceRebuildVersion = 20;
 
 	Ar << ForceRebuildVersion << DefaultVirtualVertexDistance << SafeVirtualVertexDistance << ErrorThreshold;
 	Ar << CompressionLevel;
@@ -394,6 +623,14 @@ void UAnimBoneCompressionCodec_ACLBase::PopulateDDCKey(FArchive& Ar)
 		Ar << MatchNameHash;
 	}
 
+	// Add the dedicated server bone list since if it changes, we need to re-compress
+	const TArray<FName>& ServerBoneNames = GetDefault<UACLPluginSettings>()->ServerBoneNames;
+	for (const FName& ServerBoneName : ServerBoneNames)
+	{
+		FString ServerBoneNameStr = ServerBoneName.ToString();
+		Ar << ServerBoneNameStr;
+	}
+
 #if ACL_WITH_BIND_POSE_STRIPPING
 	// Additive sequences use the additive identity as their bind pose, no need for stripping
 	if (!KeyArgs.AnimSequence.IsValidAdditive())
@@ -451,3 +688,61 @@ void UAnimBoneCompressionCodec_ACLBase::ByteSwapOut(ICompressedAnimData& AnimDat
 	MemoryStream.Serialize(CompressedData.GetData(), CompressedData.Num());
 }
 
+FTransform UAnimBoneCompressionCodec_ACLBase::ExtractRootMotionDelta(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, float StartTime, float EndTime) const
+{
+	const float Times[2] = { StartTime, EndTime };
+	FTransform Transforms[2];
+
+	// Both samples are decompressed with the same context
+	DecompressBoneAtTimes(DecompContext, TrackIndex, MakeArrayView(Times), MakeArrayView(Transforms));
+
+	return Transforms[1].GetRelativeTransform(Transforms[0]);
+}
+
+void UAnimBoneCompressionCodec_ACLBase::DecompressPoseComponentSpace(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, const TArrayView<const int32> ParentAtomIndices, TArrayView<FTransform>& OutAtoms, TArrayView<FTransform> OutComponentSpaceAtoms) const
+{
+	const int32 NumAtoms = OutAtoms.Num();
+	checkf(ParentAtomIndices.Num() == NumAtoms && OutComponentSpaceAtoms.Num() == NumAtoms, TEXT("Each output transform must have a matching parent index and component space transform"));
+
+	DecompressPose(DecompContext, RotationPairs, TranslationPairs, ScalePairs, OutAtoms);
+
+	// ACL writes every rotation sub-track before the translation and scale sub-tracks, a local transform is only
+	// complete once the whole pose has been written. We convert immediately after while the pose is still in the cache.
+	for (int32 AtomIndex = 0; AtomIndex < NumAtoms; ++AtomIndex)
+	{
+		const int32 ParentAtomIndex = ParentAtomIndices[AtomIndex];
+		if (ParentAtomIndex == INDEX_NONE)
+		{
+			OutComponentSpaceAtoms[AtomIndex] = OutAtoms[AtomIndex];
+		}
+		else
+		{
+			checkfSlow(ParentAtomIndex < AtomIndex, TEXT("Parents must precede their children: %d has parent %d"), AtomIndex, ParentAtomIndex);
+			FTransform::Multiply(&OutComponentSpaceAtoms[AtomIndex], &OutAtoms[AtomIndex], &OutComponentSpaceAtoms[ParentAtomIndex]);
+		}
+	}
+}
+
+void UAnimBoneCompressionCodec_ACLBase::DecompressWeightedPoses(const TArrayView<const FACLWeightedPoseSample> Samples, TArrayView<FTransform> OutAtoms)
+{
+	FMemMark Mark(FMemStack::Get());
+
+	FACLPoseAccumulator Accumulator(OutAtoms.Num());
+
+	for (const FACLWeightedPoseSample& Sample : Samples)
+	{
+		checkf(Sample.Codec != nullptr && Sample.DecompContext != nullptr, TEXT("Weighted pose samples require a codec and a decompression context"));
+
+		if (Sample.Weight == 0.0f)
+		{
+			continue;	// Doesn't contribute
+		}
+
+		// Sub-tracks the sample doesn't write retain the caller's value for its weight, see FACLPoseAccumulator::Flush(..)
+		Accumulator.TotalWeight += Sample.Weight;
+
+		Sample.Codec->AccumulatePose(*Sample.DecompContext, *Sample.RotationPairs, *Sample.TranslationPairs, *Sample.ScalePairs, Sample.Weight, Accumulator);
+	}
+
+	Accumulator.Flush(OutAtoms);
+}
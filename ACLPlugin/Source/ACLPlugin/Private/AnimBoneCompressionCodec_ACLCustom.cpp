@@ -82,27 +82,40 @@ void UAnimBoneCompressionCodec_ACLCustom::PopulateDDCKey(FArchive& Ar)
 }
 #endif // WITH_EDITORONLY_DATA
 
+using FACLCustomDecompression = TACLCodecDecompression<UECustomDecompressionSettings>;
+
 void UAnimBoneCompressionCodec_ACLCustom::DecompressPose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, TArrayView<FTransform>& OutAtoms) const
 {
-	const FACLCompressedAnimData& AnimData = static_cast<const FACLCompressedAnimData&>(DecompContext.CompressedAnimData);
-	const acl::compressed_tracks* CompressedClipData = AnimData.GetCompressedTracks();
-	check(CompressedClipData != nullptr && CompressedClipData->is_valid(false).empty());
+	FACLCustomDecompression::DecompressPose(DecompContext, FACLCustomDecompression::GetPooledContext(DecompContext), FACLCustomDecompression::GetServerTrackIndices(DecompContext), RotationPairs, TranslationPairs, ScalePairs, OutAtoms);
+}
 
-	acl::decompression_context<UECustomDecompressionSettings> ACLContext;
-	ACLContext.initialize(*CompressedClipData);
+void UAnimBoneCompressionCodec_ACLCustom::DecompressBone(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, FTransform& OutAtom) const
+{
+	FACLCustomDecompression::DecompressBone(DecompContext, FACLCustomDecompression::GetPooledContext(DecompContext), TrackIndex, OutAtom);
+}
 
-	::DecompressPose(DecompContext, ACLContext, RotationPairs, TranslationPairs, ScalePairs, OutAtoms);
+void UAnimBoneCompressionCodec_ACLCustom::DecompressBones(FAnimSequenceDecompressionContext& DecompContext, const TArrayView<const int32> TrackIndices, TArrayView<FTransform> OutAtoms) const
+{
+	FACLCustomDecompression::DecompressBones(DecompContext, FACLCustomDecompression::GetPooledContext(DecompContext), TrackIndices, OutAtoms);
 }
 
-void UAnimBoneCompressionCodec_ACLCustom::DecompressBone(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, FTransform& OutAtom) const
+void UAnimBoneCompressionCodec_ACLCustom::DecompressBoneAtTimes(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, const TArrayView<const float> Times, TArrayView<FTransform> OutAtoms) const
 {
-	const FACLCompressedAnimData& AnimData = static_cast<const FACLCompressedAnimData&>(DecompContext.CompressedAnimData);
-	const acl::compressed_tracks* CompressedClipData = AnimData.GetCompressedTracks();
-	check(CompressedClipData != nullptr && CompressedClipData->is_valid(false).empty());
+	FACLCustomDecompression::DecompressBoneAtTimes(DecompContext, FACLCustomDecompression::GetPooledContext(DecompContext), TrackIndex, Times, OutAtoms);
+}
 
-	acl::decompression_context<UECustomDecompressionSettings> ACLContext;
-	ACLContext.initialize(*CompressedClipData);
+void UAnimBoneCompressionCodec_ACLCustom::DecompressBonesAtTimes(FAnimSequenceDecompressionContext& DecompContext, const TArrayView<const int32> TrackIndices, const TArrayView<const float> Times, FACLPoseSamplesSoA& OutSamples) const
+{
+	FACLCustomDecompression::DecompressBonesAtTimes(DecompContext, FACLCustomDecompression::GetPooledContext(DecompContext), TrackIndices, Times, OutSamples);
+}
 
-	::DecompressBone(DecompContext, ACLContext, TrackIndex, OutAtom);
+void UAnimBoneCompressionCodec_ACLCustom::ApplyAdditivePose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, float Weight, TArrayView<FTransform>& InOutAtoms) const
+{
+	FACLCustomDecompression::ApplyAdditivePose(DecompContext, FACLCustomDecompression::GetPooledContext(DecompContext), RotationPairs, TranslationPairs, ScalePairs, Weight, InOutAtoms);
+}
+
+void UAnimBoneCompressionCodec_ACLCustom::AccumulatePose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, float Weight, FACLPoseAccumulator& Accumulator) const
+{
+	FACLCustomDecompression::AccumulatePose(DecompContext, FACLCustomDecompression::GetPooledContext(DecompContext), RotationPairs, TranslationPairs, ScalePairs, Weight, Accumulator);
 }
 
@@ -47,11 +47,21 @@ void FACLDatabaseCompressedAnimData::SerializeCompressedData(FArchive& Ar)
 void FACLDatabaseCompressedAnimData::Bind(const TArrayView<uint8> BulkData)
 {
 	check(BulkData.Num() == 0);	// Should always be empty
+	bIsDataValid = false;
 
 #if WITH_EDITORONLY_DATA
 	// We have fresh new compressed data which means either we ran compression or we loaded from the DDC
 	// We can't tell which is which so mark the database as being potentially dirty
 	EditorDatabaseMonitor::MarkDirty(Codec->DatabaseAsset);
+
+	// Validate our data once, decompression skips the safety checks and outputs a T-pose if it is invalid
+	const acl::compressed_tracks* CompressedClipData = GetCompressedTracks();
+	bIsDataValid = CompressedClipData != nullptr && CompressedClipData->is_valid(false).empty();
+
+	if (!bIsDataValid && CompressedClip.Num() != 0)
+	{
+		UE_LOG(LogAnimationCompression, Error, TEXT("ACL compressed data is invalid or corrupted, decompression will yield a T-pose"));
+	}
 #else
 	// In a cooked build, we lookup our anim sequence and database from the database asset
 	// We search by the sequence hash which lives in the top 32 bits of each entry
@@ -61,13 +71,21 @@ void FACLDatabaseCompressedAnimData::Bind(const TArrayView<uint8> BulkData)
 		const uint32 CompressedClipOffset = uint32(Codec->DatabaseAsset->CookedAnimSequenceMappings[SequenceIndex]);	// Truncate top 32 bits
 		uint8* CompressedBytes = Codec->DatabaseAsset->CookedCompressedBytes.GetData() + CompressedClipOffset;
 
+		// Validate our data once, decompression skips the safety checks and outputs a T-pose if it is invalid
 		const acl::compressed_tracks* CompressedClipData = acl::make_compressed_tracks(CompressedBytes);
-		check(CompressedClipData != nullptr && CompressedClipData->is_valid(false).empty());
+		bIsDataValid = CompressedClipData != nullptr && CompressedClipData->is_valid(false).empty();
 
-		const uint32 CompressedSize = CompressedClipData->get_size();
+		if (bIsDataValid)
+		{
+			const uint32 CompressedSize = CompressedClipData->get_size();
 
-		CompressedByteStream = TArrayView<uint8>(CompressedBytes, CompressedSize);
-		DatabaseContext = &Codec->DatabaseAsset->DatabaseContext;
+			CompressedByteStream = TArrayView<uint8>(CompressedBytes, CompressedSize);
+			DatabaseContext = &Codec->DatabaseAsset->DatabaseContext;
+		}
+		else
+		{
+			UE_LOG(LogAnimationCompression, Error, TEXT("ACL Database compressed data is invalid or corrupted for [0x%X], decompression will yield a T-pose"), SequenceNameHash);
+		}
 	}
 	else
 	{
@@ -174,8 +192,9 @@ void UAnimBoneCompressionCodec_ACLDatabase::PostCompression(const FCompressibleA
 	// Store the sequence full name's hash since we need it in cooked builds to find our data
 	AnimData.SequenceNameHash = GetTypeHash(CompressibleAnimData.FullName);
 
-	// Copy the sequence data
-	AnimData.CompressedClip = OutResult.CompressedByteStream;
+	// Copy the sequence data, the dedicated server track subset isn't supported with a database and is left out
+	const acl::compressed_tracks* CompressedClipData = acl::make_compressed_tracks(OutResult.CompressedByteStream.GetData());
+	AnimData.CompressedClip = TArray<uint8>(OutResult.CompressedByteStream.GetData(), CompressedClipData->get_size());
 
 	// When we have a database, the compressed sequence data lives in the database, zero out the compressed byte buffer
 	// since we handle the data manually
@@ -275,15 +294,18 @@ void UAnimBoneCompressionCodec_ACLDatabase::ByteSwapOut(ICompressedAnimData& Ani
 #endif
 }
 
-void UAnimBoneCompressionCodec_ACLDatabase::DecompressPose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, TArrayView<FTransform>& OutAtoms) const
+acl::decompression_context<UEDefaultDBDecompressionSettings>* UAnimBoneCompressionCodec_ACLDatabase::GetDecompressionContext(const FACLDatabaseCompressedAnimData& AnimData) const
 {
-	const FACLDatabaseCompressedAnimData& AnimData = static_cast<const FACLDatabaseCompressedAnimData&>(DecompContext.CompressedAnimData);
+	if (!AnimData.bIsDataValid)
+	{
+		return nullptr;	// Invalid data yields a T-pose
+	}
 
-	acl::decompression_context<UEDefaultDBDecompressionSettings> ACLContext;
+	const acl::compressed_tracks* CompressedClipData = nullptr;
+	acl::database_context<UEDefaultDatabaseSettings>* DatabaseContext = nullptr;
 
 #if WITH_EDITORONLY_DATA
-	acl::database_context<UEDefaultDatabaseSettings>* DatabaseContext = DatabaseAsset != nullptr ? &DatabaseAsset->DatabaseContext : nullptr;
-	if (DatabaseContext != nullptr && DatabaseContext->is_initialized())
+	if (DatabaseAsset != nullptr && DatabaseAsset->DatabaseContext.is_initialized())
 	{
 		// We are previewing, use the database and the anim sequence data contained within it
 
@@ -295,95 +317,106 @@ void UAnimBoneCompressionCodec_ACLDatabase::DecompressPose(FAnimSequenceDecompre
 			const uint32 CompressedClipOffset = uint32(DatabaseAsset->PreviewAnimSequenceMappings[SequenceIndex]);	// Truncate top 32 bits
 			const uint8* CompressedBytes = DatabaseAsset->PreviewCompressedBytes.GetData() + CompressedClipOffset;
 
-			const acl::compressed_tracks* CompressedClipData = acl::make_compressed_tracks(CompressedBytes);
-			check(CompressedClipData != nullptr && CompressedClipData->is_valid(false).empty());
-
-			ACLContext.initialize(*CompressedClipData, *DatabaseContext);
+			CompressedClipData = acl::make_compressed_tracks(CompressedBytes);
+			DatabaseContext = &DatabaseAsset->DatabaseContext;
 		}
 	}
 
-	if (!ACLContext.is_initialized())
+	if (CompressedClipData == nullptr)
 	{
 		// No preview or we live updated things and the monitor hasn't caught up yet
 		// Use the full quality that lives in the anim sequence
-		const acl::compressed_tracks* CompressedClipData = AnimData.GetCompressedTracks();
-		check(CompressedClipData != nullptr && CompressedClipData->is_valid(false).empty());
-
-		ACLContext.initialize(*CompressedClipData);
+		CompressedClipData = AnimData.GetCompressedTracks();
 	}
 #else
 	if (AnimData.CompressedByteStream.Num() == 0)
 	{
-		return;	// Our mapping must have been stale
+		return nullptr;	// Our mapping must have been stale
 	}
 
-	const acl::compressed_tracks* CompressedClipData = AnimData.GetCompressedTracks();
-	check(CompressedClipData != nullptr && CompressedClipData->is_valid(false).empty());
+	CompressedClipData = AnimData.GetCompressedTracks();
+	DatabaseContext = AnimData.DatabaseContext;
+#endif
+
+	// The pool is invalidated whenever a database is built, loaded, or destroyed so the context it holds
+	// will always reference a live database
+	bool bNeedsInitialize;
+	acl::decompression_context<UEDefaultDBDecompressionSettings>& ACLContext = GetPooledDecompressionContext<UEDefaultDBDecompressionSettings>(CompressedClipData, DatabaseContext, bNeedsInitialize);
 
-	if (AnimData.DatabaseContext == nullptr || !ACLContext.initialize(*CompressedClipData, *AnimData.DatabaseContext))
+	if (bNeedsInitialize)
 	{
-		UE_LOG(LogAnimationCompression, Warning, TEXT("ACL failed initialize decompression context, database won't be used"));
+		// Our own data was validated when it was bound and the preview data is validated when the database is built
+		checkSlow(CompressedClipData != nullptr && CompressedClipData->is_valid(false).empty());
 
-		ACLContext.initialize(*CompressedClipData);
-	}
+		// Our decompression settings skip the initialize safety checks which is where ACL validates that the database
+		// is ready and holds our sequence, we must check it ourself to fall back when our mapping is stale
+		const bool bIsDatabaseUsable = DatabaseContext != nullptr && DatabaseContext->is_initialized() && DatabaseContext->contains(*CompressedClipData);
+
+		if (!bIsDatabaseUsable || !ACLContext.initialize(*CompressedClipData, *DatabaseContext))
+		{
+#if WITH_EDITORONLY_DATA
+			// Use the full quality that lives in the anim sequence
+			CompressedClipData = AnimData.GetCompressedTracks();
+#else
+			UE_LOG(LogAnimationCompression, Warning, TEXT("ACL failed initialize decompression context, database won't be used"));
 #endif
 
-	::DecompressPose(DecompContext, ACLContext, RotationPairs, TranslationPairs, ScalePairs, OutAtoms);
+			ACLContext.initialize(*CompressedClipData);
+		}
+	}
+
+	return &ACLContext;
+}
+
+using FACLDatabaseDecompression = TACLCodecDecompression<UEDefaultDBDecompressionSettings>;
+
+void UAnimBoneCompressionCodec_ACLDatabase::DecompressPose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, TArrayView<FTransform>& OutAtoms) const
+{
+	const FACLDatabaseCompressedAnimData& AnimData = static_cast<const FACLDatabaseCompressedAnimData&>(DecompContext.CompressedAnimData);
+
+	// The dedicated server track subset is trimmed when the sequence is compressed, see PostCompression(..)
+	FACLDatabaseDecompression::DecompressPose(DecompContext, GetDecompressionContext(AnimData), nullptr, RotationPairs, TranslationPairs, ScalePairs, OutAtoms);
 }
 
 void UAnimBoneCompressionCodec_ACLDatabase::DecompressBone(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, FTransform& OutAtom) const
 {
 	const FACLDatabaseCompressedAnimData& AnimData = static_cast<const FACLDatabaseCompressedAnimData&>(DecompContext.CompressedAnimData);
 
-	acl::decompression_context<UEDefaultDBDecompressionSettings> ACLContext;
+	FACLDatabaseDecompression::DecompressBone(DecompContext, GetDecompressionContext(AnimData), TrackIndex, OutAtom);
+}
 
-#if WITH_EDITORONLY_DATA
-	acl::database_context<UEDefaultDatabaseSettings>* DatabaseContext = DatabaseAsset != nullptr ? &DatabaseAsset->DatabaseContext : nullptr;
-	if (DatabaseContext != nullptr && DatabaseContext->is_initialized())
-	{
-		// We are previewing, use the database and the anim sequence data contained within it
+void UAnimBoneCompressionCodec_ACLDatabase::DecompressBones(FAnimSequenceDecompressionContext& DecompContext, const TArrayView<const int32> TrackIndices, TArrayView<FTransform> OutAtoms) const
+{
+	const FACLDatabaseCompressedAnimData& AnimData = static_cast<const FACLDatabaseCompressedAnimData&>(DecompContext.CompressedAnimData);
 
-		// Lookup our anim sequence from the database asset
-		// We search by the sequence hash which lives in the top 32 bits of each entry
-		const int32 SequenceIndex = Algo::BinarySearchBy(DatabaseAsset->PreviewAnimSequenceMappings, AnimData.SequenceNameHash, [](uint64 InValue) { return uint32(InValue >> 32); });
-		if (SequenceIndex != INDEX_NONE)
-		{
-			const uint32 CompressedClipOffset = uint32(DatabaseAsset->PreviewAnimSequenceMappings[SequenceIndex]);	// Truncate top 32 bits
-			const uint8* CompressedBytes = DatabaseAsset->PreviewCompressedBytes.GetData() + CompressedClipOffset;
+	FACLDatabaseDecompression::DecompressBones(DecompContext, GetDecompressionContext(AnimData), TrackIndices, OutAtoms);
+}
 
-			const acl::compressed_tracks* CompressedClipData = acl::make_compressed_tracks(CompressedBytes);
-			check(CompressedClipData != nullptr && CompressedClipData->is_valid(false).empty());
+void UAnimBoneCompressionCodec_ACLDatabase::DecompressBoneAtTimes(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, const TArrayView<const float> Times, TArrayView<FTransform> OutAtoms) const
+{
+	const FACLDatabaseCompressedAnimData& AnimData = static_cast<const FACLDatabaseCompressedAnimData&>(DecompContext.CompressedAnimData);
 
-			ACLContext.initialize(*CompressedClipData, *DatabaseContext);
-		}
-	}
+	FACLDatabaseDecompression::DecompressBoneAtTimes(DecompContext, GetDecompressionContext(AnimData), TrackIndex, Times, OutAtoms);
+}
 
-	if (!ACLContext.is_initialized())
-	{
-		// No preview or we live updated things and the monitor hasn't caught up yet
-		// Use the full quality that lives in the anim sequence
-		const acl::compressed_tracks* CompressedClipData = AnimData.GetCompressedTracks();
-		check(CompressedClipData != nullptr && CompressedClipData->is_valid(false).empty());
+void UAnimBoneCompressionCodec_ACLDatabase::DecompressBonesAtTimes(FAnimSequenceDecompressionContext& DecompContext, const TArrayView<const int32> TrackIndices, const TArrayView<const float> Times, FACLPoseSamplesSoA& OutSamples) const
+{
+	const FACLDatabaseCompressedAnimData& AnimData = static_cast<const FACLDatabaseCompressedAnimData&>(DecompContext.CompressedAnimData);
 
-		ACLContext.initialize(*CompressedClipData);
-	}
-#else
-	if (AnimData.CompressedByteStream.Num() == 0)
-	{
-		return;	// Our mapping must have been stale
-	}
+	FACLDatabaseDecompression::DecompressBonesAtTimes(DecompContext, GetDecompressionContext(AnimData), TrackIndices, Times, OutSamples);
+}
 
-	const acl::compressed_tracks* CompressedClipData = AnimData.GetCompressedTracks();
-	check(CompressedClipData != nullptr && CompressedClipData->is_valid(false).empty());
+void UAnimBoneCompressionCodec_ACLDatabase::ApplyAdditivePose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, float Weight, TArrayView<FTransform>& InOutAtoms) const
+{
+	const FACLDatabaseCompressedAnimData& AnimData = static_cast<const FACLDatabaseCompressedAnimData&>(DecompContext.CompressedAnimData);
 
-	if (AnimData.DatabaseContext == nullptr || !ACLContext.initialize(*CompressedClipData, *AnimData.DatabaseContext))
-	{
-		UE_LOG(LogAnimationCompression, Warning, TEXT("ACL failed initialize decompression context, database won't be used"));
+	FACLDatabaseDecompression::ApplyAdditivePose(DecompContext, GetDecompressionContext(AnimData), RotationPairs, TranslationPairs, ScalePairs, Weight, InOutAtoms);
+}
 
-		ACLContext.initialize(*CompressedClipData);
-	}
-#endif
+void UAnimBoneCompressionCodec_ACLDatabase::AccumulatePose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, float Weight, FACLPoseAccumulator& Accumulator) const
+{
+	const FACLDatabaseCompressedAnimData& AnimData = static_cast<const FACLDatabaseCompressedAnimData&>(DecompContext.CompressedAnimData);
 
-	::DecompressBone(DecompContext, ACLContext, TrackIndex, OutAtom);
+	FACLDatabaseDecompression::AccumulatePose(DecompContext, GetDecompressionContext(AnimData), RotationPairs, TranslationPairs, ScalePairs, Weight, Accumulator);
 }
 
@@ -55,27 +55,40 @@ void UAnimBoneCompressionCodec_ACLSafe::PopulateDDCKey(FArchive& Ar)
 }
 #endif // WITH_EDITORONLY_DATA
 
+using FACLSafeDecompression = TACLCodecDecompression<UESafeDecompressionSettings>;
+
 void UAnimBoneCompressionCodec_ACLSafe::DecompressPose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, TArrayView<FTransform>& OutAtoms) const
 {
-	const FACLCompressedAnimData& AnimData = static_cast<const FACLCompressedAnimData&>(DecompContext.CompressedAnimData);
-	const acl::compressed_tracks* CompressedClipData = AnimData.GetCompressedTracks();
-	check(CompressedClipData != nullptr && CompressedClipData->is_valid(false).empty());
+	FACLSafeDecompression::DecompressPose(DecompContext, FACLSafeDecompression::GetPooledContext(DecompContext), FACLSafeDecompression::GetServerTrackIndices(DecompContext), RotationPairs, TranslationPairs, ScalePairs, OutAtoms);
+}
 
-	acl::decompression_context<UESafeDecompressionSettings> ACLContext;
-	ACLContext.initialize(*CompressedClipData);
+void UAnimBoneCompressionCodec_ACLSafe::DecompressBone(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, FTransform& OutAtom) const
+{
+	FACLSafeDecompression::DecompressBone(DecompContext, FACLSafeDecompression::GetPooledContext(DecompContext), TrackIndex, OutAtom);
+}
 
-	::DecompressPose(DecompContext, ACLContext, RotationPairs, TranslationPairs, ScalePairs, OutAtoms);
+void UAnimBoneCompressionCodec_ACLSafe::DecompressBones(FAnimSequenceDecompressionContext& DecompContext, const TArrayView<const int32> TrackIndices, TArrayView<FTransform> OutAtoms) const
+{
+	FACLSafeDecompression::DecompressBones(DecompContext, FACLSafeDecompression::GetPooledContext(DecompContext), TrackIndices, OutAtoms);
 }
 
-void UAnimBoneCompressionCodec_ACLSafe::DecompressBone(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, FTransform& OutAtom) const
+void UAnimBoneCompressionCodec_ACLSafe::DecompressBoneAtTimes(FAnimSequenceDecompressionContext& DecompContext, int32 TrackIndex, const TArrayView<const float> Times, TArrayView<FTransform> OutAtoms) const
 {
-	const FACLCompressedAnimData& AnimData = static_cast<const FACLCompressedAnimData&>(DecompContext.CompressedAnimData);
-	const acl::compressed_tracks* CompressedClipData = AnimData.GetCompressedTracks();
-	check(CompressedClipData != nullptr && CompressedClipData->is_valid(false).empty());
+	FACLSafeDecompression::DecompressBoneAtTimes(DecompContext, FACLSafeDecompression::GetPooledContext(DecompContext), TrackIndex, Times, OutAtoms);
+}
 
-	acl::decompression_context<UESafeDecompressionSettings> ACLContext;
-	ACLContext.initialize(*CompressedClipData);
+void UAnimBoneCompressionCodec_ACLSafe::DecompressBonesAtTimes(FAnimSequenceDecompressionContext& DecompContext, const TArrayView<const int32> TrackIndices, const TArrayView<const float> Times, FACLPoseSamplesSoA& OutSamples) const
+{
+	FACLSafeDecompression::DecompressBonesAtTimes(DecompContext, FACLSafeDecompression::GetPooledContext(DecompContext), TrackIndices, Times, OutSamples);
+}
 
-	::DecompressBone(DecompContext, ACLContext, TrackIndex, OutAtom);
+void UAnimBoneCompressionCodec_ACLSafe::ApplyAdditivePose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, float Weight, TArrayView<FTransform>& InOutAtoms) const
+{
+	FACLSafeDecompression::ApplyAdditivePose(DecompContext, FACLSafeDecompression::GetPooledContext(DecompContext), RotationPairs, TranslationPairs, ScalePairs, Weight, InOutAtoms);
+}
+
+void UAnimBoneCompressionCodec_ACLSafe::AccumulatePose(FAnimSequenceDecompressionContext& DecompContext, const BoneTrackArray& RotationPairs, const BoneTrackArray& TranslationPairs, const BoneTrackArray& ScalePairs, float Weight, FACLPoseAccumulator& Accumulator) const
+{
+	FACLSafeDecompression::AccumulatePose(DecompContext, FACLSafeDecompression::GetPooledContext(DecompContext), RotationPairs, TranslationPairs, ScalePairs, Weight, Accumulator);
 }
 
@@ -22,15 +22,20 @@ THIRD_PARTY_INCLUDES_START
 #include <acl/compression/compress.h>
 #include <acl/compression/track.h>
 #include <acl/compression/track_array.h>
-#include <acl/compression/track_error.h>
 #include <acl/core/compressed_tracks_version.h>
 THIRD_PARTY_INCLUDES_END
 #endif
 
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeRWLock.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
 THIRD_PARTY_INCLUDES_START
 #include <acl/decompression/decompress.h>
 THIRD_PARTY_INCLUDES_END
 
+CSV_DECLARE_CATEGORY_EXTERN(ACL);
+
 UAnimCurveCompressionCodec_ACL::UAnimCurveCompressionCodec_ACL(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
@@ -146,7 +151,15 @@ bool UAnimCurveCompressionCodec_ACL::Compress(const FCompressibleAnimData& AnimS
 	const float SampleRate = bIsStaticPose ? 30.0f : (float(NumSamples - 1) / SequenceLength);
 	const float InvSampleRate = 1.0f / SampleRate;
 
-	acl::track_array_float1f Tracks(ACLAllocatorImpl, NumCurves);
+	// Every temporary allocation lives in the arena of this thread, it is released at once when we are done
+	FACLScopedArenaAllocator ArenaScope;
+	ACLArenaAllocator& ArenaAllocator = ArenaScope.Get();
+
+	// When we measure the compression error, the raw tracks are handed over to a background task and must outlive the arena
+	const bool bMeasureCompressionError = ShouldMeasureCompressionError(AnimSeq.FullName);
+	acl::iallocator& TrackAllocator = bMeasureCompressionError ? static_cast<acl::iallocator&>(ACLAllocatorImpl) : static_cast<acl::iallocator&>(ArenaAllocator);
+
+	acl::track_array_float1f Tracks(TrackAllocator, NumCurves);
 
 	for (int32 CurveIndex = 0; CurveIndex < NumCurves; ++CurveIndex)
 	{
@@ -187,7 +200,7 @@ bool UAnimCurveCompressionCodec_ACL::Compress(const FCompressibleAnimData& AnimS
 		Desc.output_index = CurveIndex;
 		Desc.precision = Precision;
 
-		acl::track_float1f Track = acl::track_float1f::make_reserve(Desc, ACLAllocatorImpl, NumSamples, SampleRate);
+		acl::track_float1f Track = acl::track_float1f::make_reserve(Desc, TrackAllocator, NumSamples, SampleRate);
 		for (int32 SampleIndex = 0; SampleIndex < NumSamples; ++SampleIndex)
 		{
 			const float SampleTime = FMath::Clamp(SampleIndex * InvSampleRate, 0.0f, SequenceLength);
@@ -203,7 +216,7 @@ bool UAnimCurveCompressionCodec_ACL::Compress(const FCompressibleAnimData& AnimS
 
 	acl::compressed_tracks* CompressedTracks = nullptr;
 	acl::output_stats Stats;
-	const acl::error_result CompressionResult = acl::compress_track_list(ACLAllocatorImpl, Tracks, Settings, CompressedTracks, Stats);
+	const acl::error_result CompressionResult = acl::compress_track_list(ArenaAllocator, Tracks, Settings, CompressedTracks, Stats);
 
 	if (CompressionResult.any())
 	{
@@ -221,18 +234,14 @@ bool UAnimCurveCompressionCodec_ACL::Compress(const FCompressibleAnimData& AnimS
 
 	OutResult.Codec = this;
 
-#if !NO_LOGGING
-	{
-		acl::decompression_context<acl::debug_scalar_decompression_settings> Context;
-		Context.initialize(*CompressedTracks);
-		const acl::track_error Error = acl::calculate_compression_error(ACLAllocatorImpl, Tracks, Context);
+	UE_LOG(LogAnimationCompression, Verbose, TEXT("ACL Curves compressed size: %u bytes [%s]"), CompressedDataSize, *AnimSeq.FullName);
 
-		UE_LOG(LogAnimationCompression, Verbose, TEXT("ACL Curves compressed size: %u bytes [%s]"), CompressedDataSize, *AnimSeq.FullName);
-		UE_LOG(LogAnimationCompression, Verbose, TEXT("ACL Curves error: %.4f (curve %u @ %.3f) [%s]"), Error.error, Error.index, Error.sample_time, *AnimSeq.FullName);
+	if (bMeasureCompressionError)
+	{
+		MeasureCurveCompressionErrorAsync(AnimSeq.FullName, MoveTemp(Tracks), *CompressedTracks);
 	}
-#endif
 
-	ACLAllocatorImpl.deallocate(CompressedTracks, CompressedDataSize);
+	ArenaAllocator.deallocate(CompressedTracks, CompressedDataSize);
 	return true;
 }
 #endif // WITH_EDITORONLY_DATA
@@ -254,19 +263,224 @@ struct UECurveDecompressionSettings final : public acl::decompression_settings
 #endif
 };
 
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
+using FACLCurveKey = FName;
+#else
+using FACLCurveKey = SmartName::UID_Type;
+#endif
+
+/** Maps the curves of a sequence to their track index. */
+struct FCurveTrackIndexMap
+{
+	// What the map was built from, used to detect stale entries
+	uint32 CompressedTracksHash = 0;
+	const void* CurveNames = nullptr;
+	int32 NumCurves = 0;
+
+	TMap<FACLCurveKey, int32> TrackIndices;
+
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
+	// The position of each track once sorted by name and the curve names in that order.
+	// Curves are written in sorted order so that our output can be built reading them linearly.
+	TArray<int32> TrackToSortedIndex;
+	TArray<FName> SortedCurveNames;
+#endif
+};
+
+using FCurveTrackIndexMapPtr = TSharedPtr<const FCurveTrackIndexMap, ESPMode::ThreadSafe>;
+
+/*
+ * Curve track index maps, per sequence.
+ * Built the first time a sequence is decompressed and shared by every thread.
+ * Maps are immutable once built and stale maps are replaced, they remain alive while in use.
+ * The cache is bounded, once full it is flushed and maps are rebuilt on demand.
+ */
+static FRWLock GCurveTrackIndexMapsLock;
+static TMap<const uint8*, FCurveTrackIndexMapPtr> GCurveTrackIndexMaps;
+static constexpr int32 MaxNumCurveTrackIndexMaps = 4096;
+
+/*
+ * A small direct mapped cache of curve track index maps in front of the shared one.
+ * It lives in thread local storage so that evaluating curves doesn't contend on the shared lock every frame.
+ * Entries hold a reference to their map, they remain valid when the shared cache is flushed and are
+ * validated like the shared entries are.
+ */
+struct FCurveTrackIndexMapCache
+{
+	static constexpr uint32 NumEntries = 32;
+
+	struct FEntry
+	{
+		const uint8* SequenceKey = nullptr;
+		FCurveTrackIndexMapPtr Map;
+	};
+
+	FEntry Entries[NumEntries];
+};
+
+static thread_local FCurveTrackIndexMapCache GCurveTrackIndexMapCache;
+
+static bool IsCurveTrackIndexMapFor(const FCurveTrackIndexMap& Map, const FCompressedAnimSequence& AnimSeq, const acl::compressed_tracks& CompressedTracks)
+{
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
+	const TArray<FAnimCompressedCurveIndexedName>& CurveNames = AnimSeq.IndexedCurveNames;
+#else
+	const TArray<FSmartName>& CurveNames = AnimSeq.CompressedCurveNames;
+#endif
+
+	return Map.CompressedTracksHash == CompressedTracks.get_hash() &&
+		Map.CurveNames == CurveNames.GetData() &&
+		Map.NumCurves == CurveNames.Num();
+}
+
+static FCurveTrackIndexMapPtr BuildCurveTrackIndexMap(const FCompressedAnimSequence& AnimSeq, const acl::compressed_tracks& CompressedTracks)
+{
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
+	const TArray<FAnimCompressedCurveIndexedName>& CurveNames = AnimSeq.IndexedCurveNames;
+#else
+	const TArray<FSmartName>& CurveNames = AnimSeq.CompressedCurveNames;
+#endif
+
+	const int32 NumCurves = CurveNames.Num();
+
+	TSharedPtr<FCurveTrackIndexMap, ESPMode::ThreadSafe> Map = MakeShared<FCurveTrackIndexMap, ESPMode::ThreadSafe>();
+	Map->CompressedTracksHash = CompressedTracks.get_hash();
+	Map->CurveNames = CurveNames.GetData();
+	Map->NumCurves = NumCurves;
+	Map->TrackIndices.Reserve(NumCurves);
+
+	for (int32 CurveIndex = 0; CurveIndex < NumCurves; ++CurveIndex)
+	{
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
+		const FACLCurveKey CurveKey = CurveNames[CurveIndex].CurveName;
+#else
+		const FACLCurveKey CurveKey = CurveNames[CurveIndex].UID;
+#endif
+
+		// If a curve is present more than once, the first one wins like a linear search would
+		if (!Map->TrackIndices.Contains(CurveKey))
+		{
+			Map->TrackIndices.Add(CurveKey, CurveIndex);
+		}
+	}
+
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
+	// The sorted order is stored with our curve names, CurveIndex holds the track index of the N-th sorted curve
+	Map->TrackToSortedIndex.SetNumUninitialized(NumCurves);
+	Map->SortedCurveNames.SetNumUninitialized(NumCurves);
+
+	for (int32 SortedIndex = 0; SortedIndex < NumCurves; ++SortedIndex)
+	{
+		const int32 TrackIndex = CurveNames[SortedIndex].CurveIndex;
+		Map->TrackToSortedIndex[TrackIndex] = SortedIndex;
+		Map->SortedCurveNames[SortedIndex] = CurveNames[TrackIndex].CurveName;
+	}
+#endif
+
+	return Map;
+}
+
+/** Returns the curve track index map of the provided sequence from the shared cache, building it if needed. */
+static FCurveTrackIndexMapPtr FindOrBuildSharedCurveTrackIndexMap(const FCompressedAnimSequence& AnimSeq, const acl::compressed_tracks& CompressedTracks)
+{
+	const uint8* SequenceKey = AnimSeq.CompressedCurveByteStream.GetData();
+
+	{
+		FReadScopeLock ReadLock(GCurveTrackIndexMapsLock);
+
+		const FCurveTrackIndexMapPtr* Map = GCurveTrackIndexMaps.Find(SequenceKey);
+		if (Map != nullptr && IsCurveTrackIndexMapFor(**Map, AnimSeq, CompressedTracks))
+		{
+			return *Map;
+		}
+	}
+
+	// Build our map outside the lock, if another thread beats us to it, we'll use theirs
+	FCurveTrackIndexMapPtr NewMap = BuildCurveTrackIndexMap(AnimSeq, CompressedTracks);
+
+	FWriteScopeLock WriteLock(GCurveTrackIndexMapsLock);
+
+	FCurveTrackIndexMapPtr* Map = GCurveTrackIndexMaps.Find(SequenceKey);
+	if (Map != nullptr && IsCurveTrackIndexMapFor(**Map, AnimSeq, CompressedTracks))
+	{
+		return *Map;
+	}
+
+	if (Map == nullptr && GCurveTrackIndexMaps.Num() >= MaxNumCurveTrackIndexMaps)
+	{
+		GCurveTrackIndexMaps.Empty();
+	}
+
+	GCurveTrackIndexMaps.Add(SequenceKey, NewMap);
+	return NewMap;
+}
+
+/*
+ * Returns the curve track index map of the provided sequence, building it if needed.
+ * The returned pointer remains valid until the next call from the same thread.
+ */
+static const FCurveTrackIndexMap* GetCurveTrackIndexMap(const FCompressedAnimSequence& AnimSeq, const acl::compressed_tracks& CompressedTracks)
+{
+	const uint8* SequenceKey = AnimSeq.CompressedCurveByteStream.GetData();
+
+	FCurveTrackIndexMapCache::FEntry& Entry = GCurveTrackIndexMapCache.Entries[PointerHash(SequenceKey) % FCurveTrackIndexMapCache::NumEntries];
+
+	const bool bIsCacheHit = Entry.SequenceKey == SequenceKey &&
+		Entry.Map.IsValid() &&
+		IsCurveTrackIndexMapFor(*Entry.Map, AnimSeq, CompressedTracks);
+
+	if (bIsCacheHit)
+	{
+		CSV_CUSTOM_STAT(ACL, CurveTrackIndexMapHits, 1, ECsvCustomStatOp::Accumulate);
+		return Entry.Map.Get();
+	}
+
+	CSV_CUSTOM_STAT(ACL, CurveTrackIndexMapMisses, 1, ECsvCustomStatOp::Accumulate);
+
+	Entry.SequenceKey = SequenceKey;
+	Entry.Map = FindOrBuildSharedCurveTrackIndexMap(AnimSeq, CompressedTracks);
+	return Entry.Map.Get();
+}
+
+/** Finds the track index of every curve provided or INDEX_NONE if the sequence does not contain it. */
+static void FindCurveTrackIndices(const FCurveTrackIndexMap& Map, const TArrayView<const FACLCurveKey> Curves, TArrayView<int32> OutTrackIndices)
+{
+	for (int32 Index = 0; Index < Curves.Num(); ++Index)
+	{
+		const int32* TrackIndex = Map.TrackIndices.Find(Curves[Index]);
+		OutTrackIndices[Index] = TrackIndex != nullptr ? *TrackIndex : INDEX_NONE;
+	}
+}
+
+static TAutoConsoleVariable<float> CVarACLCurvePartialDecompressionRatio(
+	TEXT("ACL.CurvePartialDecompressionRatio"),
+	0.0f,
+	TEXT("When the proportion of curves that pass the curve filter (e.g. with LODs) is below this ratio, only the enabled curves are decompressed one by one.\n")
+	TEXT("Otherwise every curve is decompressed in a single pass and disabled curves are skipped when written.\n")
+	TEXT("The crossover has not been profiled yet, see decompression_performance.md before enabling it.\n")
+	TEXT("0.0: Always decompress every curve (default)\n")
+	TEXT("1.0: Always decompress enabled curves one by one"),
+	ECVF_Default);
+
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
 struct UECurveWriter final : public acl::track_writer
 {
-	TArray<float, FAnimStackAllocator>& Buffer;
+	// Curve values in sorted order
+	float* SortedValues;
 
-	explicit UECurveWriter(TArray<float, FAnimStackAllocator>& Buffer_)
-		: Buffer(Buffer_)
+	// The sorted position of each track
+	const int32* TrackToSortedIndex;
+
+	UECurveWriter(float* SortedValues_, const int32* TrackToSortedIndex_)
+		: SortedValues(SortedValues_)
+		, TrackToSortedIndex(TrackToSortedIndex_)
 	{
 	}
 
 	FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL write_float1(uint32_t TrackIndex, rtm::scalarf_arg0 Value)
 	{
-		Buffer[TrackIndex] = rtm::scalar_cast(Value);
+		// Disabled curves are removed by the curve filter when we build our output, no need to check here
+		SortedValues[TrackToSortedIndex[TrackIndex]] = rtm::scalar_cast(Value);
 	}
 };
 #else
@@ -274,29 +488,107 @@ struct UECurveWriter final : public acl::track_writer
 {
 	const TArray<FSmartName>& CompressedCurveNames;
 	FBlendedCurve& Curves;
+	const bool* EnabledTracks;
 
-	UECurveWriter(const TArray<FSmartName>& CompressedCurveNames_, FBlendedCurve& Curves_)
+	UECurveWriter(const TArray<FSmartName>& CompressedCurveNames_, FBlendedCurve& Curves_, const bool* EnabledTracks_)
 		: CompressedCurveNames(CompressedCurveNames_)
 		, Curves(Curves_)
+		, EnabledTracks(EnabledTracks_)
 	{
 	}
 
 	FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL write_float1(uint32_t TrackIndex, rtm::scalarf_arg0 Value)
 	{
-		const FSmartName& CurveName = CompressedCurveNames[TrackIndex];
-		if (Curves.IsEnabled(CurveName.UID))
+		if (EnabledTracks[TrackIndex])
 		{
+			const FSmartName& CurveName = CompressedCurveNames[TrackIndex];
 			Curves.Set(CurveName.UID, rtm::scalar_cast(Value));
 		}
 	}
 };
 #endif
 
+/*
+ * Finds which curve tracks pass the curve filter.
+ * Returns the number of enabled tracks, OutEnabledTracks[i] is true if track i is enabled.
+ * The track index map is only required with UE 5.3+.
+ */
+static int32 FindEnabledCurveTracks(const FCompressedAnimSequence& AnimSeq, const FCurveTrackIndexMap* TrackIndexMap, const FBlendedCurve& Curves, bool* OutEnabledTracks)
+{
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
+	const int32 NumCurves = AnimSeq.IndexedCurveNames.Num();
+
+	const UE::Anim::FCurveFilter* Filter = Curves.GetFilter();
+	const UE::Anim::ECurveFilterMode FilterMode = Filter != nullptr ? Filter->GetFilterMode() : UE::Anim::ECurveFilterMode::None;
+
+	if (FilterMode == UE::Anim::ECurveFilterMode::DisallowAll)
+	{
+		FMemory::Memset(OutEnabledTracks, 0, sizeof(bool) * NumCurves);
+		return 0;
+	}
+
+	const bool bAllowOnlyFiltered = FilterMode == UE::Anim::ECurveFilterMode::AllowOnlyFiltered;
+	const bool bDisallowFiltered = FilterMode == UE::Anim::ECurveFilterMode::DisallowFiltered;
+	if ((!bAllowOnlyFiltered && !bDisallowFiltered) || Filter->IsEmpty())
+	{
+		// Everything passes, let the filter sort out any edge case when we build our output
+		FMemory::Memset(OutEnabledTracks, 1, sizeof(bool) * NumCurves);
+		return NumCurves;
+	}
+
+	// Find the tracks of every curve present in the filter
+	const int32 NumFilterCurves = Filter->Num();
+	FName* FilterCurveNames = new(FMemStack::Get()) FName[NumFilterCurves];
+	int32* FilterTrackIndices = new(FMemStack::Get()) int32[NumFilterCurves];
+
+	int32 FilterCurveIndex = 0;
+	Filter->ForEachElement([FilterCurveNames, &FilterCurveIndex](const UE::Anim::FCurveFilterElement& InElement)
+		{
+			FilterCurveNames[FilterCurveIndex++] = InElement.Name;
+		});
+
+	FindCurveTrackIndices(*TrackIndexMap, MakeArrayView(FilterCurveNames, FilterCurveIndex), MakeArrayView(FilterTrackIndices, FilterCurveIndex));
+
+	// Curves in the filter are the only ones allowed or the only ones disallowed
+	FMemory::Memset(OutEnabledTracks, bDisallowFiltered ? 1 : 0, sizeof(bool) * NumCurves);
+
+	for (int32 Index = 0; Index < FilterCurveIndex; ++Index)
+	{
+		const int32 TrackIndex = FilterTrackIndices[Index];
+		if (TrackIndex != INDEX_NONE)
+		{
+			OutEnabledTracks[TrackIndex] = bAllowOnlyFiltered;
+		}
+	}
+
+	int32 NumEnabledTracks = 0;
+	for (int32 TrackIndex = 0; TrackIndex < NumCurves; ++TrackIndex)
+	{
+		NumEnabledTracks += OutEnabledTracks[TrackIndex] ? 1 : 0;
+	}
+
+	return NumEnabledTracks;
+#else
+	const TArray<FSmartName>& CompressedCurveNames = AnimSeq.CompressedCurveNames;
+	const int32 NumCurves = CompressedCurveNames.Num();
+
+	int32 NumEnabledTracks = 0;
+	for (int32 TrackIndex = 0; TrackIndex < NumCurves; ++TrackIndex)
+	{
+		const bool bIsEnabled = Curves.IsEnabled(CompressedCurveNames[TrackIndex].UID);
+
+		OutEnabledTracks[TrackIndex] = bIsEnabled;
+		NumEnabledTracks += bIsEnabled ? 1 : 0;
+	}
+
+	return NumEnabledTracks;
+#endif
+}
+
 void UAnimCurveCompressionCodec_ACL::DecompressCurves(const FCompressedAnimSequence& AnimSeq, FBlendedCurve& Curves, float CurrentTime) const
 {
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
-	const TArray<FAnimCompressedCurveIndexedName>& IndexedCurveNames = AnimSeq.IndexedCurveNames;
-	const int32 NumCurves = IndexedCurveNames.Num();
+	const int32 NumCurves = AnimSeq.IndexedCurveNames.Num();
 #else
 	const TArray<FSmartName>& CompressedCurveNames = AnimSeq.CompressedCurveNames;
 	const int32 NumCurves = CompressedCurveNames.Num();
@@ -310,30 +602,84 @@ void UAnimCurveCompressionCodec_ACL::DecompressCurves(const FCompressedAnimSeque
 	const acl::compressed_tracks* CompressedTracks = acl::make_compressed_tracks(AnimSeq.CompressedCurveByteStream.GetData());
 	check(CompressedTracks != nullptr && CompressedTracks->is_valid(false).empty());
 
-	acl::decompression_context<UECurveDecompressionSettings> Context;
-	Context.initialize(*CompressedTracks);
-	Context.seek(CurrentTime, acl::sample_rounding_policy::none);
+	FMemMark Mark(FMemStack::Get());
 
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
-	TArray<float, FAnimStackAllocator> DecompressionBuffer;
-	DecompressionBuffer.SetNumUninitialized(NumCurves);
+	const FCurveTrackIndexMap* TrackIndexMap = GetCurveTrackIndexMap(AnimSeq, *CompressedTracks);
+#else
+	// Curves are filtered by UID and written directly, we don't need the track index map
+	const FCurveTrackIndexMap* TrackIndexMap = nullptr;
+#endif
+
+	// Find which curves we need before we decompress anything
+	bool* EnabledTracks = new(FMemStack::Get()) bool[NumCurves];
+	const int32 NumEnabledTracks = FindEnabledCurveTracks(AnimSeq, TrackIndexMap, Curves, EnabledTracks);
 
-	UECurveWriter TrackWriter(DecompressionBuffer);
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
+	// Values are written in sorted order
+	float* SortedValues = new(FMemStack::Get()) float[NumCurves];
+
+	UECurveWriter TrackWriter(SortedValues, TrackIndexMap->TrackToSortedIndex.GetData());
 #else
-	UECurveWriter TrackWriter(CompressedCurveNames, Curves);
+	if (NumEnabledTracks == 0)
+	{
+		return;	// Nothing to write
+	}
+
+	UECurveWriter TrackWriter(CompressedCurveNames, Curves, EnabledTracks);
+#endif
+
+	if (NumEnabledTracks != 0)
+	{
+		acl::decompression_context<UECurveDecompressionSettings> Context;
+		Context.initialize(*CompressedTracks);
+		Context.seek(CurrentTime, acl::sample_rounding_policy::none);
+
+		const float PartialDecompressionRatio = CVarACLCurvePartialDecompressionRatio.GetValueOnAnyThread();
+		if (NumEnabledTracks < NumCurves * PartialDecompressionRatio)
+		{
+			// Only a few curves are enabled, decompress them one by one
+			CSV_CUSTOM_STAT(ACL, CurvePartialDecompressions, 1, ECsvCustomStatOp::Accumulate);
+
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
+			// Disabled curves are removed by the curve filter but we still initialize them
+			FMemory::Memzero(SortedValues, sizeof(float) * NumCurves);
 #endif
 
-	Context.decompress_tracks(TrackWriter);
+			for (int32 TrackIndex = 0; TrackIndex < NumCurves; ++TrackIndex)
+			{
+				if (EnabledTracks[TrackIndex])
+				{
+					Context.decompress_track(TrackIndex, TrackWriter);
+				}
+			}
+		}
+		else
+		{
+			// Most curves are enabled, decompress everything linearly
+			CSV_CUSTOM_STAT(ACL, CurveFullDecompressions, 1, ECsvCustomStatOp::Accumulate);
 
+			Context.decompress_tracks(TrackWriter);
+		}
+	}
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
-	auto GetNameFromIndex = [&IndexedCurveNames](int32 InCurveIndex)
+	else
+	{
+		// Every curve is filtered out, let the filter produce our output
+		FMemory::Memzero(SortedValues, sizeof(float) * NumCurves);
+	}
+
+	// Our names and values are already in sorted order, they are read linearly
+	const FName* SortedCurveNames = TrackIndexMap->SortedCurveNames.GetData();
+
+	auto GetNameFromIndex = [SortedCurveNames](int32 InCurveIndex)
 	{
-		return IndexedCurveNames[IndexedCurveNames[InCurveIndex].CurveIndex].CurveName;
+		return SortedCurveNames[InCurveIndex];
 	};
 
-	auto GetValueFromIndex = [&DecompressionBuffer, &IndexedCurveNames](int32 InCurveIndex)
+	auto GetValueFromIndex = [SortedValues](int32 InCurveIndex)
 	{
-		return DecompressionBuffer[IndexedCurveNames[InCurveIndex].CurveIndex];
+		return SortedValues[InCurveIndex];
 	};
 
 	UE::Anim::FCurveUtils::BuildSorted(Curves, NumCurves, GetNameFromIndex, GetValueFromIndex, Curves.GetFilter());
@@ -362,47 +708,68 @@ float UAnimCurveCompressionCodec_ACL::DecompressCurve(const FCompressedAnimSeque
 #endif
 {
 #if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
-	const TArray<FAnimCompressedCurveIndexedName>& IndexedCurveNames = AnimSeq.IndexedCurveNames;
-	const int32 NumCurves = IndexedCurveNames.Num();
+	const FACLCurveKey CurveKey = CurveName;
 #else
-	const TArray<FSmartName>& CompressedCurveNames = AnimSeq.CompressedCurveNames;
-	const int32 NumCurves = CompressedCurveNames.Num();
+	const FACLCurveKey CurveKey = CurveUID;
 #endif
 
-	if (NumCurves == 0)
+	float Value = 0.0f;
+	DecompressCurves(AnimSeq, MakeArrayView(&CurveKey, 1), CurrentTime, MakeArrayView(&Value, 1));
+
+	return Value;
+}
+
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
+void UAnimCurveCompressionCodec_ACL::DecompressCurves(const FCompressedAnimSequence& AnimSeq, const TArrayView<const FName> CurveNames, float CurrentTime, TArrayView<float> OutValues) const
+#else
+void UAnimCurveCompressionCodec_ACL::DecompressCurves(const FCompressedAnimSequence& AnimSeq, const TArrayView<const SmartName::UID_Type> CurveNames, float CurrentTime, TArrayView<float> OutValues) const
+#endif
+{
+	checkf(CurveNames.Num() == OutValues.Num(), TEXT("Each curve must have a matching output value"));
+
+	const int32 NumRequestedCurves = CurveNames.Num();
+
+#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
+	const int32 NumCurves = AnimSeq.IndexedCurveNames.Num();
+#else
+	const int32 NumCurves = AnimSeq.CompressedCurveNames.Num();
+#endif
+
+	if (NumCurves == 0 || NumRequestedCurves == 0)
 	{
-		return 0.0f;
+		for (float& Value : OutValues)
+		{
+			Value = 0.0f;
+		}
+
+		return;
 	}
 
 	const acl::compressed_tracks* CompressedTracks = acl::make_compressed_tracks(AnimSeq.CompressedCurveByteStream.GetData());
 	check(CompressedTracks != nullptr && CompressedTracks->is_valid(false).empty());
 
+	FMemMark Mark(FMemStack::Get());
+
+	int32* TrackIndices = new(FMemStack::Get()) int32[NumRequestedCurves];
+	const FCurveTrackIndexMap* TrackIndexMap = GetCurveTrackIndexMap(AnimSeq, *CompressedTracks);
+	FindCurveTrackIndices(*TrackIndexMap, CurveNames, MakeArrayView(TrackIndices, NumRequestedCurves));
+
 	acl::decompression_context<UECurveDecompressionSettings> Context;
 	Context.initialize(*CompressedTracks);
 	Context.seek(CurrentTime, acl::sample_rounding_policy::none);
 
-	int32 TrackIndex = -1;
-	for (int32 CurveIndex = 0; CurveIndex < NumCurves; ++CurveIndex)
+	for (int32 Index = 0; Index < NumRequestedCurves; ++Index)
 	{
-#if ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 3
-		if (IndexedCurveNames[CurveIndex].CurveName == CurveName)
-#else
-		if (CompressedCurveNames[CurveIndex].UID == CurveUID)
-#endif
+		const int32 TrackIndex = TrackIndices[Index];
+		if (TrackIndex == INDEX_NONE)
 		{
-			TrackIndex = CurveIndex;
-			break;
+			OutValues[Index] = 0.0f;	// Track not found
+			continue;
 		}
-	}
 
-	if (TrackIndex < 0)
-	{
-		return 0.0f;	// Track not found
-	}
-
-	UEScalarCurveWriter TrackWriter;
-	Context.decompress_track(TrackIndex, TrackWriter);
+		UEScalarCurveWriter TrackWriter;
+		Context.decompress_track(TrackIndex, TrackWriter);
 
-	return TrackWriter.SampleValue;
+		OutValues[Index] = TrackWriter.SampleValue;
+	}
 }
-
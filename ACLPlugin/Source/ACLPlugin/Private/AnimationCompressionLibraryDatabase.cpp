@@ -8,6 +8,8 @@
 #include "LatentActions.h"
 #include "Containers/Ticker.h"
 
+#include "ACLDecompressionImpl.h"
+
 #if (ENGINE_MAJOR_VERSION >= 5 && ENGINE_MINOR_VERSION >= 1)
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AnimationCompressionLibraryDatabase)
 #endif
@@ -464,6 +466,9 @@ void UAnimationCompressionLibraryDatabase::UpdatePreviewState(bool bBuildDatabas
 		PreviewDatabaseStreamer.Reset();
 		DatabaseContext.reset();
 
+		// Pooled decompression contexts might reference our old database
+		InvalidateDecompressionCaches();
+
 		BuildDatabase(PreviewCompressedBytes, PreviewAnimSequenceMappings, PreviewBulkData);
 
 		if (PreviewCompressedBytes.Num() != 0)
@@ -613,6 +618,9 @@ void UAnimationCompressionLibraryDatabase::BeginDestroy()
 	}
 #endif
 
+	// Pooled decompression contexts might reference our database
+	InvalidateDecompressionCaches();
+
 	// Manually run the destructor since the container is opaque
 	DatabaseContext.~database_context<UEDefaultDatabaseSettings>();
 }
@@ -630,6 +638,9 @@ void UAnimationCompressionLibraryDatabase::PostLoad()
 
 		const bool ContextInitResult = DatabaseContext.initialize(ACLAllocatorImpl, *CompressedDatabase, *DatabaseStreamer, *DatabaseStreamer);
 		checkf(ContextInitResult, TEXT("ACL failed to initialize the database context"));
+
+		// Pooled decompression contexts might have been initialized without our database
+		InvalidateDecompressionCaches();
 	}
 
 	if (!GIsEditor)
@@ -1043,6 +1054,10 @@ bool UAnimationCompressionLibraryDatabase::UpdateVisualFidelityTicker(float Delt
 #endif
 
 			CurrentVisualFidelity = Request.Fidelity;
+
+			// Cached decompressed data might have been decoded at our old fidelity
+			InvalidateDecompressionCaches();
+
 			if (Request.Result != nullptr)
 			{
 				*Request.Result = ACLVisualFidelityChangeResult::Completed;
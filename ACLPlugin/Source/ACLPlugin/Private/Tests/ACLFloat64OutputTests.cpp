@@ -0,0 +1,113 @@
+// Copyright 2026 Nicholas Frechette. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ACLDecompressionImpl.h"
+#include "HAL/PlatformTime.h"
+
+namespace ACL
+{
+	namespace Private
+	{
+		/** Writes every sub-track one at a time as they are decompressed, how FUEOutputWriter behaves without ACL_WITH_FLOAT64_OUTPUT. */
+		struct FDirectFloat64OutputWriter
+		{
+			FACLTransform* Atoms;
+
+			FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL write_rotation(uint32_t TrackIndex, rtm::quatf_arg0 Rotation) { Atoms[TrackIndex].SetRotationRaw(Rotation); }
+			FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL write_translation(uint32_t TrackIndex, rtm::vector4f_arg0 Translation) { Atoms[TrackIndex].SetTranslationRaw(Translation); }
+			FORCEINLINE_DEBUGGABLE void RTM_SIMD_CALL write_scale(uint32_t TrackIndex, rtm::vector4f_arg0 Scale) { Atoms[TrackIndex].SetScale3DRaw(Scale); }
+			void Flush() {}
+		};
+
+		// Writes every track in the order the decompression context does, rotations first then translations and scales
+		template<class WriterType>
+		static void WriteFloat32Pose(WriterType& Writer, const TArray<rtm::qvvf>& TrackValues)
+		{
+			for (int32 TrackIndex = 0; TrackIndex < TrackValues.Num(); ++TrackIndex)
+			{
+				Writer.write_rotation(TrackIndex, TrackValues[TrackIndex].rotation);
+			}
+
+			for (int32 TrackIndex = 0; TrackIndex < TrackValues.Num(); ++TrackIndex)
+			{
+				Writer.write_translation(TrackIndex, TrackValues[TrackIndex].translation);
+			}
+
+			for (int32 TrackIndex = 0; TrackIndex < TrackValues.Num(); ++TrackIndex)
+			{
+				Writer.write_scale(TrackIndex, TrackValues[TrackIndex].scale);
+			}
+
+			Writer.Flush();
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FACLFloat64OutputTest, "Plugins.ACL.Decompression.Float64Output",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter | EAutomationTestFlags::PerfFilter)
+
+/*
+ * Writes a 200 bone pose with the pose writer and compares it against writing each sub-track directly.
+ * Both are timed, with large world coordinates this measures the batched float32 to float64 conversion.
+ */
+bool FACLFloat64OutputTest::RunTest(const FString& Parameters)
+{
+	using namespace ACL::Private;
+
+	constexpr int32 NumBones = 200;
+	constexpr int32 NumIterations = 20000;
+
+	TArray<rtm::qvvf> TrackValues;
+	TArray<FAtomIndices> TrackToAtomsMap;
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		const FQuat Rotation(FRotator(1.5f * BoneIndex, -0.75f * BoneIndex, 10.0f));
+		const rtm::quatf ACLRotation = UEQuatToACL(Rotation);
+		const rtm::vector4f Translation = rtm::vector_set(float(BoneIndex), -2.0f * BoneIndex, 0.5f);
+		const rtm::vector4f Scale = rtm::vector_set(1.0f + 0.01f * BoneIndex);
+		TrackValues.Add(rtm::qvv_set(ACLRotation, Translation, Scale));
+
+		TrackToAtomsMap.Add(FAtomIndices{ (uint16)BoneIndex, (uint16)BoneIndex, (uint16)BoneIndex });
+	}
+
+	TArray<FTransform> DirectPose;
+	DirectPose.Init(FTransform::Identity, NumBones);
+	TArray<FTransform> WriterPose;
+	WriterPose.Init(FTransform::Identity, NumBones);
+
+	TArrayView<FTransform> WriterPoseView(WriterPose);
+
+	FDirectFloat64OutputWriter DirectWriter{ static_cast<FACLTransform*>(DirectPose.GetData()) };
+	FUEOutputWriter<false> PoseWriter(TrackToAtomsMap.GetData(), WriterPoseView);
+
+	const double DirectStartTime = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		WriteFloat32Pose(DirectWriter, TrackValues);
+	}
+	const double DirectTime = FPlatformTime::Seconds() - DirectStartTime;
+
+	const double WriterStartTime = FPlatformTime::Seconds();
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		WriteFloat32Pose(PoseWriter, TrackValues);
+	}
+	const double WriterTime = FPlatformTime::Seconds() - WriterStartTime;
+
+	AddInfo(FString::Printf(TEXT("%d bones, float64 output %s: direct %.3f us, pose writer %.3f us per pose"),
+		NumBones, ACL_WITH_FLOAT64_OUTPUT ? TEXT("enabled") : TEXT("disabled"),
+		DirectTime * 1.0E6 / NumIterations, WriterTime * 1.0E6 / NumIterations));
+
+	for (int32 BoneIndex = 0; BoneIndex < NumBones; ++BoneIndex)
+	{
+		// The values are converted the same way, they must match exactly
+		TestTrue(FString::Printf(TEXT("Bone %d matches the direct output"), BoneIndex), DirectPose[BoneIndex].Equals(WriterPose[BoneIndex], 0.0f));
+	}
+
+	return true;
+}
+
+#endif	// WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,179 @@
+// Copyright 2026 Nicholas Frechette. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ACLDecompressionImpl.h"
+
+namespace ACL
+{
+	namespace Private
+	{
+		// Writes the sub-tracks a writer doesn't skip the same way the decompression context does
+		template<class WriterType>
+		static void WriteSyntheticPose(WriterType& Writer, const TArray<FTransform>& TrackValues)
+		{
+			for (int32 TrackIndex = 0; TrackIndex < TrackValues.Num(); ++TrackIndex)
+			{
+				if (!Writer.skip_track_rotation(TrackIndex))
+				{
+					Writer.write_rotation(TrackIndex, UEQuatToACL(TrackValues[TrackIndex].GetRotation()));
+				}
+
+				if (!Writer.skip_track_translation(TrackIndex))
+				{
+					Writer.write_translation(TrackIndex, UEVector3ToACL(TrackValues[TrackIndex].GetTranslation()));
+				}
+
+				if (!Writer.skip_track_scale(TrackIndex))
+				{
+					Writer.write_scale(TrackIndex, UEVector3ToACL(TrackValues[TrackIndex].GetScale3D()));
+				}
+			}
+		}
+
+		static TArray<FAtomIndices> MakeTrackToAtomsMap(int32 NumTracks, const TArray<BoneTrackPair>& RotationPairs, const TArray<BoneTrackPair>& TranslationPairs, const TArray<BoneTrackPair>& ScalePairs)
+		{
+			TArray<FAtomIndices> TrackToAtomsMap;
+			TrackToAtomsMap.SetNumUninitialized(NumTracks);
+			FMemory::Memset(TrackToAtomsMap.GetData(), 0xFF, sizeof(FAtomIndices) * NumTracks);
+
+			for (const BoneTrackPair& Pair : RotationPairs)
+			{
+				TrackToAtomsMap[Pair.TrackIndex].Rotation = (uint16)Pair.AtomIndex;
+			}
+
+			for (const BoneTrackPair& Pair : TranslationPairs)
+			{
+				TrackToAtomsMap[Pair.TrackIndex].Translation = (uint16)Pair.AtomIndex;
+			}
+
+			for (const BoneTrackPair& Pair : ScalePairs)
+			{
+				TrackToAtomsMap[Pair.TrackIndex].Scale = (uint16)Pair.AtomIndex;
+			}
+
+			return TrackToAtomsMap;
+		}
+	}
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FACLPoseAccumulatorPartialBoneSetTest, "Plugins.ACL.Decompression.PoseAccumulator.PartialBoneSet",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+/*
+ * Blends two samples that only write a subset of the output pose with the pose accumulator and compares the result
+ * against a blend of the same samples written individually on top of the reference pose, as DecompressPose(..) does.
+ */
+bool FACLPoseAccumulatorPartialBoneSetTest::RunTest(const FString& Parameters)
+{
+	using namespace ACL::Private;
+
+	constexpr int32 NumAtoms = 6;
+	constexpr int32 NumTracks = 4;
+
+	TArray<FTransform> RefPose;
+	for (int32 AtomIndex = 0; AtomIndex < NumAtoms; ++AtomIndex)
+	{
+		const FQuat Rotation(FRotator(10.0f * AtomIndex, -15.0f * AtomIndex, 5.0f));
+		RefPose.Add(FTransform(Rotation, FVector(AtomIndex, 2.0f * AtomIndex, -1.0f), FVector(1.0f + 0.25f * AtomIndex)));
+	}
+
+	// Track values of each sample, the second one lies in the opposite hemisphere for some rotations
+	TArray<FTransform> TrackValuesA;
+	TArray<FTransform> TrackValuesB;
+	for (int32 TrackIndex = 0; TrackIndex < NumTracks; ++TrackIndex)
+	{
+		const FQuat RotationA(FRotator(30.0f + 20.0f * TrackIndex, 45.0f, -10.0f * TrackIndex));
+		TrackValuesA.Add(FTransform(RotationA, FVector(10.0f, -5.0f * TrackIndex, 3.0f), FVector(0.5f + 0.5f * TrackIndex)));
+
+		FQuat RotationB(FRotator(-20.0f, 60.0f - 15.0f * TrackIndex, 25.0f));
+		if ((TrackIndex % 2) != 0)
+		{
+			RotationB = -RotationB;
+		}
+
+		TrackValuesB.Add(FTransform(RotationB, FVector(-4.0f * TrackIndex, 7.0f, 1.0f), FVector(2.0f)));
+	}
+
+	// Sample A maps every track but only a few scales, sample B maps a few tracks and has no scale.
+	// Atoms 4 and 5 have no track in either sample.
+	const TArray<BoneTrackPair> RotationPairsA = { BoneTrackPair(0, 0), BoneTrackPair(1, 1), BoneTrackPair(2, 2), BoneTrackPair(3, 3) };
+	const TArray<BoneTrackPair> TranslationPairsA = { BoneTrackPair(0, 0), BoneTrackPair(1, 1), BoneTrackPair(2, 2), BoneTrackPair(3, 3) };
+	const TArray<BoneTrackPair> ScalePairsA = { BoneTrackPair(0, 0), BoneTrackPair(2, 2) };
+
+	const TArray<BoneTrackPair> RotationPairsB = { BoneTrackPair(0, 0), BoneTrackPair(3, 1) };
+	const TArray<BoneTrackPair> TranslationPairsB = { BoneTrackPair(0, 0) };
+	const TArray<BoneTrackPair> ScalePairsB;
+
+	const TArray<FAtomIndices> TrackToAtomsMapA = MakeTrackToAtomsMap(NumTracks, RotationPairsA, TranslationPairsA, ScalePairsA);
+	const TArray<FAtomIndices> TrackToAtomsMapB = MakeTrackToAtomsMap(NumTracks, RotationPairsB, TranslationPairsB, ScalePairsB);
+
+	constexpr float WeightA = 0.3f;
+	constexpr float WeightB = 0.7f;
+
+	// Standalone poses start from the reference pose
+	TArray<FTransform> PoseA = RefPose;
+	TArray<FTransform> PoseB = RefPose;
+	{
+		TArrayView<FTransform> PoseAView(PoseA);
+		FUEOutputWriter<false> WriterA(TrackToAtomsMapA.GetData(), PoseAView);
+		WriteSyntheticPose(WriterA, TrackValuesA);
+		WriterA.Flush();
+
+		TArrayView<FTransform> PoseBView(PoseB);
+		FUEOutputWriter<false> WriterB(TrackToAtomsMapB.GetData(), PoseBView);
+		WriteSyntheticPose(WriterB, TrackValuesB);
+		WriterB.Flush();
+	}
+
+	// Blend them the same way the engine blends poses together
+	TArray<FTransform> ExpectedPose;
+	for (int32 AtomIndex = 0; AtomIndex < NumAtoms; ++AtomIndex)
+	{
+		FTransform Expected = PoseA[AtomIndex] * ScalarRegister(WeightA);
+		Expected.AccumulateWithShortestRotation(PoseB[AtomIndex], ScalarRegister(WeightB));
+		Expected.NormalizeRotation();
+		ExpectedPose.Add(Expected);
+	}
+
+	// Accumulate both samples directly
+	TArray<FTransform> BlendedPose = RefPose;
+	{
+		FMemMark Mark(FMemStack::Get());
+
+		FACLPoseAccumulator Accumulator(NumAtoms);
+
+		Accumulator.TotalWeight += WeightA;
+		FUEOutputBlendWriter<false> WriterA(nullptr, TrackToAtomsMapA.GetData(), WeightA, Accumulator);
+		WriteSyntheticPose(WriterA, TrackValuesA);
+
+		Accumulator.TotalWeight += WeightB;
+		FUEOutputBlendWriter<false> WriterB(nullptr, TrackToAtomsMapB.GetData(), WeightB, Accumulator);
+		WriteSyntheticPose(WriterB, TrackValuesB);
+
+		TArrayView<FTransform> BlendedPoseView(BlendedPose);
+		Accumulator.Flush(BlendedPoseView);
+	}
+
+	for (int32 AtomIndex = 0; AtomIndex < NumAtoms; ++AtomIndex)
+	{
+		const FTransform& Expected = ExpectedPose[AtomIndex];
+		const FTransform& Blended = BlendedPose[AtomIndex];
+
+		TestTrue(FString::Printf(TEXT("Atom %d rotation matches the blend of standalone poses"), AtomIndex), Expected.GetRotation().Equals(Blended.GetRotation(), 1.0E-4F));
+		TestTrue(FString::Printf(TEXT("Atom %d translation matches the blend of standalone poses"), AtomIndex), Expected.GetTranslation().Equals(Blended.GetTranslation(), 1.0E-3F));
+		TestTrue(FString::Printf(TEXT("Atom %d scale matches the blend of standalone poses"), AtomIndex), Expected.GetScale3D().Equals(Blended.GetScale3D(), 1.0E-4F));
+	}
+
+	// Atoms without tracks must retain the reference pose exactly
+	for (int32 AtomIndex = 4; AtomIndex < NumAtoms; ++AtomIndex)
+	{
+		TestTrue(FString::Printf(TEXT("Atom %d without tracks retains the reference pose"), AtomIndex), RefPose[AtomIndex].Equals(BlendedPose[AtomIndex], 0.0f));
+	}
+
+	return true;
+}
+
+#endif	// WITH_DEV_AUTOMATION_TESTS
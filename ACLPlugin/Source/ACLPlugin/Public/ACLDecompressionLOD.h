@@ -0,0 +1,25 @@
+#pragma once
+
+// Copyright 2026 Nicholas Frechette. All Rights Reserved.
+
+#include "CoreMinimal.h"
+
+/*
+ * Sets the significance of the poses decompressed by the current thread for the lifetime of the scope
+ * (e.g. while evaluating the anim instance of a character, with its value from the significance manager).
+ * 1.0 is fully significant and lower values are less significant. When ACL.DecompressionLOD is enabled,
+ * poses below ACL.DecompressionLODSignificanceThreshold sample their nearest keyframe without interpolating.
+ * Scopes can nest, the previous significance is restored when the scope ends.
+ */
+class ACLPLUGIN_API FACLScopedDecompressionSignificance
+{
+public:
+	explicit FACLScopedDecompressionSignificance(float Significance);
+	~FACLScopedDecompressionSignificance();
+
+	FACLScopedDecompressionSignificance(const FACLScopedDecompressionSignificance&) = delete;
+	FACLScopedDecompressionSignificance& operator=(const FACLScopedDecompressionSignificance&) = delete;
+
+private:
+	float PreviousSignificance;
+};
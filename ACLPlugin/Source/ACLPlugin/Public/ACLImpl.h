@@ -31,6 +31,11 @@
 #if (ENGINE_MAJOR_VERSION <= 5 && ENGINE_MINOR_VERSION <= 0) && PLATFORM_PS4
 	// Enable usage of popcount instruction
 	#define ACL_USE_POPCOUNT
+#elif defined(PLATFORM_ALWAYS_HAS_SSE4_2) && PLATFORM_ALWAYS_HAS_SSE4_2
+	// x64 targets that require SSE 4.2 or later (e.g. with bUseAVX or MinCpuArchX64) always support popcount.
+	// Every CPU that supports SSE 4.2 also supports popcount.
+	// We can't dispatch at runtime since ACL is header only, all of it would need to be compiled once per ISA.
+	#define ACL_USE_POPCOUNT
 #endif
 
 //////////////////////////////////////////////////////////////////////////
@@ -101,6 +106,7 @@ THIRD_PARTY_INCLUDES_END
 THIRD_PARTY_INCLUDES_START
 #include <acl/compression/track_array.h>
 #include <acl/compression/compression_level.h>
+#include <acl/core/additive_utils.h>
 THIRD_PARTY_INCLUDES_END
 #endif
 
@@ -163,14 +169,11 @@ struct UEDefaultDecompressionSettings : public acl::default_transform_decompress
 	// Only support our latest version
 	static constexpr acl::compressed_tracks_version16 version_supported() { return acl::compressed_tracks_version16::latest; }
 
-#if UE_BUILD_SHIPPING
-	// Shipping builds do not need safety checks, by then the game has been tested enough
-	// Only data corruption could cause a safety check to fail
-	// We keep this disabled regardless because it is generally better to output a T-pose than to have a
-	// potential crash. Corruption can happen and it would be unfortunate if a demo or playtest failed
-	// as a result of a crash that we can otherwise recover from.
-	//static constexpr bool skip_initialize_safety_checks() { return true; }
-#endif
+	// Compressed data is validated once when it is bound (see FACLCompressedAnimData::Bind) and we never
+	// decompress data that failed validation, we output a T-pose instead. Corruption can happen and it
+	// is generally better to output a T-pose than to crash but there is no need to validate every time
+	// a context is initialized.
+	static constexpr bool skip_initialize_safety_checks() { return true; }
 };
 
 struct UEDebugDecompressionSettings : public acl::debug_transform_decompression_settings
@@ -197,6 +200,9 @@ struct UEDefaultDatabaseSettings final : public acl::default_database_settings
 struct UEDefaultDBDecompressionSettings final : public UEDefaultDecompressionSettings
 {
 	using database_settings_type = UEDefaultDatabaseSettings;
+
+	// Database membership isn't covered by the validation performed at bind time, callers must check that the
+	// database is initialized and contains the sequence before initializing a context with it
 };
 
 using UEDebugDatabaseSettings = acl::debug_database_settings;
@@ -271,10 +277,130 @@ ACLPLUGIN_API acl::rotation_format8 GetRotationFormat(ACLRotationFormat Format);
 ACLPLUGIN_API acl::vector_format8 GetVectorFormat(ACLVectorFormat Format);
 ACLPLUGIN_API acl::compression_level8 GetCompressionLevel(ACLCompressionLevel Level);
 
-ACLPLUGIN_API acl::track_array_qvvf BuildACLTransformTrackArray(ACLAllocator& AllocatorImpl, const FCompressibleAnimData& CompressibleAnimData,
+/*
+ * An arena allocator for the short lived allocations of a single compression (tracks, strings, segments, etc).
+ * Memory is carved linearly out of fixed size blocks and everything is released at once when the arena is reset.
+ * Deallocations are ignored unless they release the last allocation made. Allocations larger than MaxAllocationSize
+ * fall back to the heap and are freed when deallocated, they would otherwise remain alive until the reset.
+ * Use it through FACLScopedArenaAllocator: each thread has its own arena that retains a single block between compressions.
+ */
+class ACLPLUGIN_API ACLArenaAllocator final : public acl::iallocator
+{
+public:
+	static constexpr size_t BlockSize = 4 * 1024 * 1024;
+	static constexpr size_t MaxAllocationSize = BlockSize / 4;
+
+	virtual ~ACLArenaAllocator();
+
+	virtual void* allocate(size_t size, size_t alignment = acl::iallocator::k_default_alignment);
+	virtual void deallocate(void* ptr, size_t size);
+
+	/** Releases every allocation at once. Only a single block is retained. */
+	void Reset();
+
+	/** Returns how many bytes were in use at the peak since the last reset, heap allocations included. */
+	size_t GetPeakSize() const { return PeakSize; }
+
+private:
+	struct FBlock
+	{
+		uint8* Data;
+		size_t Size;
+	};
+
+	TArray<FBlock> Blocks;
+
+	// The block we allocate from and how much of it is used
+	int32 CurrentBlockIndex = INDEX_NONE;
+	size_t CurrentBlockOffset = 0;
+
+	// How much of the blocks before the current one is used
+	size_t PreviousBlocksSize = 0;
+
+	struct FHeapAllocation
+	{
+		void* Ptr;
+		size_t Size;
+	};
+
+	// Allocations larger than MaxAllocationSize that are still alive and their total size
+	TArray<FHeapAllocation> HeapAllocations;
+	size_t HeapAllocationsSize = 0;
+
+	size_t PeakSize = 0;
+};
+
+/*
+ * Provides the arena allocator of the current thread for the lifetime of the scope (e.g. a whole compression).
+ * Scopes can nest, the arena is reset when the outermost scope ends. Anything allocated from it must be released
+ * or copied out before then.
+ */
+class ACLPLUGIN_API FACLScopedArenaAllocator
+{
+public:
+	FACLScopedArenaAllocator();
+	~FACLScopedArenaAllocator();
+
+	FACLScopedArenaAllocator(const FACLScopedArenaAllocator&) = delete;
+	FACLScopedArenaAllocator& operator=(const FACLScopedArenaAllocator&) = delete;
+
+	ACLArenaAllocator& Get() const;
+};
+
+/** Returns the largest peak size of any arena since the editor started (see ACLArenaAllocator::GetPeakSize()). */
+ACLPLUGIN_API size_t GetArenaAllocatorMaxPeakSize();
+
+/** The mapping between the skeleton bones and the UE tracks of a sequence. Build it once per compression input and share it. */
+struct FACLBoneTrackMapping
+{
+	/** The UE track index of every skeleton bone or INDEX_NONE if the sequence has no track for it. */
+	TArray<int32> BoneToTrackMap;
+
+	/** A bit is true if the corresponding UE track has a skeleton bone mapped to it, false otherwise. */
+	TBitArray<> MappedUETracks;
+};
+
+ACLPLUGIN_API FACLBoneTrackMapping BuildBoneTrackMapping(const FCompressibleAnimData& CompressibleAnimData);
+
+ACLPLUGIN_API acl::track_array_qvvf BuildACLTransformTrackArray(acl::iallocator& AllocatorImpl, const FCompressibleAnimData& CompressibleAnimData,
 	float DefaultVirtualVertexDistance, float SafeVirtualVertexDistance,
 	bool bBuildAdditiveBase, ACLPhantomTrackMode PhantomTrackMode);
 
+ACLPLUGIN_API acl::track_array_qvvf BuildACLTransformTrackArray(acl::iallocator& AllocatorImpl, const FCompressibleAnimData& CompressibleAnimData, const FACLBoneTrackMapping& BoneTrackMapping,
+	float DefaultVirtualVertexDistance, float SafeVirtualVertexDistance,
+	bool bBuildAdditiveBase, ACLPhantomTrackMode PhantomTrackMode);
+
+/** The compression error measured by ACL for a sequence. See ACL.CompressionErrorSampling. */
+struct FACLCompressionErrorStats
+{
+	/** The largest bone error in centimeters, the track it was measured on and when. Negative if it wasn't measured. */
+	float BoneError = -1.0f;
+	uint32 BoneTrackIndex = 0;
+	float BoneSampleTime = 0.0f;
+
+	/** The largest curve error, the curve it was measured on and when. Negative if it wasn't measured. */
+	float CurveError = -1.0f;
+	uint32 CurveIndex = 0;
+	float CurveSampleTime = 0.0f;
+};
+
+/** Returns whether or not the compression error of a sequence should be measured based on ACL.CompressionErrorSampling. */
+ACLPLUGIN_API bool ShouldMeasureCompressionError(const FString& SequenceName);
+
+/*
+ * Measures the bone compression error of a sequence in a background task and records it in the compression error stats.
+ * The raw and additive base tracks are moved into the task, they must not come from the arena allocator.
+ * The compressed tracks are copied.
+ */
+ACLPLUGIN_API void MeasureBoneCompressionErrorAsync(const FString& SequenceName, acl::track_array_qvvf&& RawTracks, acl::track_array_qvvf&& BaseTracks,
+	acl::additive_clip_format8 AdditiveFormat, const acl::compressed_tracks& CompressedTracks);
+
+/** Same as above for curves. */
+ACLPLUGIN_API void MeasureCurveCompressionErrorAsync(const FString& SequenceName, acl::track_array_float1f&& RawTracks, const acl::compressed_tracks& CompressedTracks);
+
+/** Retrieves the compression error measured for a sequence since the editor started. Returns false if nothing was measured. */
+ACLPLUGIN_API bool GetCompressionErrorStats(const FString& SequenceName, FACLCompressionErrorStats& OutStats);
+
 /** Compatibility utilities */
 ACLPLUGIN_API uint32 GetNumSamples(const FCompressibleAnimData& CompressibleAnimData);
 ACLPLUGIN_API float GetSequenceLength(const UAnimSequence& AnimSeq);